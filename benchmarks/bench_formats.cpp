@@ -0,0 +1,300 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Record : public figcone::Config {
+    FIGCONE_PARAM(id, int);
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(port, int);
+    FIGCONE_PARAM(weight, double);
+    FIGCONE_PARAM(enabled, bool);
+    FIGCONE_PARAM(timeout, double);
+    FIGCONE_PARAM(retries, int);
+    FIGCONE_PARAM(zone, std::string);
+    FIGCONE_PARAM(priority, int);
+};
+
+struct RuntimeReflCfg : public figcone::Config {
+    FIGCONE_NODELIST(records, std::vector<Record>);
+};
+
+struct StaticReflRecord {
+    int id;
+    std::string name;
+    std::string host;
+    int port;
+    double weight;
+    bool enabled;
+    double timeout;
+    int retries;
+    std::string zone;
+    int priority;
+};
+
+struct StaticReflCfg {
+    std::vector<StaticReflRecord> records;
+};
+
+constexpr auto fieldsPerRecord = 10;
+
+enum class Format {
+    Json,
+    Yaml,
+    Toml,
+    Ini,
+    Xml,
+    Shoal
+};
+
+struct Field {
+    std::string name;
+    std::string value;
+    bool isString;
+};
+
+std::vector<Field> recordFields(int index)
+{
+    const auto number = std::to_string(index);
+    return {{"id", number, false},
+            {"name", "record" + number, true},
+            {"host", "10.0." + std::to_string(index % 256) + ".1", true},
+            {"port", std::to_string(8000 + index % 1000), false},
+            {"weight", "0.75", false},
+            {"enabled", "1", false},
+            {"timeout", "2.5", false},
+            {"retries", std::to_string(index % 5), false},
+            {"zone", "zone" + std::to_string(index % 4), true},
+            {"priority", std::to_string(index % 10), false}};
+}
+
+std::string quoted(const Field& field)
+{
+    return field.isString ? "\"" + field.value + "\"" : field.value;
+}
+
+template<Format format>
+std::string makeConfig(int fieldsCount)
+{
+    const auto recordsCount = std::max(fieldsCount / fieldsPerRecord, 1);
+    auto result = std::string{};
+    if constexpr (format == Format::Json)
+        result += "{\"records\": [";
+    else if constexpr (format == Format::Yaml)
+        result += "records:\n";
+    else if constexpr (format == Format::Xml)
+        result += "<root>\n<records>\n";
+    else if constexpr (format == Format::Shoal)
+        result += "#records:\n";
+
+    for (auto i = 0; i < recordsCount; ++i) {
+        const auto fields = recordFields(i);
+        if constexpr (format == Format::Json) {
+            result += i ? ",\n{" : "\n{";
+            for (auto& field : fields)
+                result += (&field == &fields.front() ? "\"" : ", \"") + field.name + "\": " + quoted(field);
+            result += "}";
+        }
+        else if constexpr (format == Format::Yaml) {
+            for (auto& field : fields)
+                result += (&field == &fields.front() ? "  - " : "    ") + field.name + ": " + field.value + "\n";
+        }
+        else if constexpr (format == Format::Toml || format == Format::Ini) {
+            if constexpr (format == Format::Toml)
+                result += "[[records]]\n";
+            else
+                result += "[records." + std::to_string(i) + "]\n";
+            for (auto& field : fields)
+                result += field.name + " = " + quoted(field) + "\n";
+        }
+        else if constexpr (format == Format::Xml) {
+            result += "<record";
+            for (auto& field : fields)
+                result += " " + field.name + "=\"" + field.value + "\"";
+            result += "/>\n";
+        }
+        else if constexpr (format == Format::Shoal) {
+            result += "###\n";
+            for (auto& field : fields)
+                result += "  " + field.name + " = " + quoted(field) + "\n";
+        }
+    }
+
+    if constexpr (format == Format::Json)
+        result += "]}";
+    else if constexpr (format == Format::Xml)
+        result += "</records>\n</root>";
+    else if constexpr (format == Format::Shoal)
+        result += "---";
+    return result;
+}
+
+template<Format format>
+auto makeParser()
+{
+#ifdef FIGCONE_JSON_AVAILABLE
+    if constexpr (format == Format::Json)
+        return figcone::json::Parser{};
+#endif
+#ifdef FIGCONE_YAML_AVAILABLE
+    if constexpr (format == Format::Yaml)
+        return figcone::yaml::Parser{};
+#endif
+#ifdef FIGCONE_TOML_AVAILABLE
+    if constexpr (format == Format::Toml)
+        return figcone::toml::Parser{};
+#endif
+#ifdef FIGCONE_INI_AVAILABLE
+    if constexpr (format == Format::Ini)
+        return figcone::ini::Parser{};
+#endif
+#ifdef FIGCONE_XML_AVAILABLE
+    if constexpr (format == Format::Xml)
+        return figcone::xml::Parser{};
+#endif
+#ifdef FIGCONE_SHOAL_AVAILABLE
+    if constexpr (format == Format::Shoal)
+        return figcone::shoal::Parser{};
+#endif
+}
+
+template<Format format, typename TCfg>
+TCfg readConfig(figcone::ConfigReader& cfgReader, const std::string& configContent)
+{
+#ifdef FIGCONE_JSON_AVAILABLE
+    if constexpr (format == Format::Json)
+        return cfgReader.readJson<TCfg>(configContent);
+#endif
+#ifdef FIGCONE_YAML_AVAILABLE
+    if constexpr (format == Format::Yaml)
+        return cfgReader.readYaml<TCfg>(configContent);
+#endif
+#ifdef FIGCONE_TOML_AVAILABLE
+    if constexpr (format == Format::Toml)
+        return cfgReader.readToml<TCfg>(configContent);
+#endif
+#ifdef FIGCONE_INI_AVAILABLE
+    if constexpr (format == Format::Ini)
+        return cfgReader.readIni<TCfg>(configContent);
+#endif
+#ifdef FIGCONE_XML_AVAILABLE
+    if constexpr (format == Format::Xml)
+        return cfgReader.readXml<TCfg>(configContent);
+#endif
+#ifdef FIGCONE_SHOAL_AVAILABLE
+    if constexpr (format == Format::Shoal)
+        return cfgReader.readShoal<TCfg>(configContent);
+#endif
+}
+
+class TreeProvider : public figcone::IParser {
+public:
+    explicit TreeProvider(figcone::Tree tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(*tree_);
+    }
+
+private:
+    std::optional<figcone::Tree> tree_;
+};
+
+void setFieldsProcessed(benchmark::State& state)
+{
+    state.SetItemsProcessed(state.iterations() * std::max(state.range(0), std::int64_t{fieldsPerRecord}));
+}
+
+//Parsing of the config into the figcone::Tree
+template<Format format>
+void parse(benchmark::State& state)
+{
+    const auto configContent = makeConfig<format>(static_cast<int>(state.range(0)));
+    auto parser = makeParser<format>();
+    for (auto _ : state) {
+        auto configStream = std::istringstream{configContent};
+        auto tree = parser.parse(configStream);
+        benchmark::DoNotOptimize(tree);
+    }
+    setFieldsProcessed(state);
+}
+
+//Loading of the parsed figcone::Tree into the config structure
+template<Format format, typename TCfg>
+void bind(benchmark::State& state)
+{
+    const auto configContent = makeConfig<format>(static_cast<int>(state.range(0)));
+    auto parser = makeParser<format>();
+    auto cfgReader = figcone::ConfigReader{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto configStream = std::istringstream{configContent};
+        auto treeProvider = TreeProvider{parser.parse(configStream)};
+        state.ResumeTiming();
+
+        auto cfg = cfgReader.read<TCfg>("", treeProvider);
+        benchmark::DoNotOptimize(cfg);
+    }
+    setFieldsProcessed(state);
+}
+
+//Parsing and loading with the format's ConfigReader::read* method
+template<Format format, typename TCfg>
+void read(benchmark::State& state)
+{
+    const auto configContent = makeConfig<format>(static_cast<int>(state.range(0)));
+    auto cfgReader = figcone::ConfigReader{};
+    for (auto _ : state) {
+        auto cfg = readConfig<format, TCfg>(cfgReader, configContent);
+        benchmark::DoNotOptimize(cfg);
+    }
+    setFieldsProcessed(state);
+}
+
+void setFieldsCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("fields")->Unit(benchmark::kMillisecond);
+    for (auto fieldsCount : {10, 1000, 100000, 1000000})
+        benchmark->Arg(fieldsCount);
+}
+
+} //namespace
+
+#define FIGCONE_BENCHMARK_FORMAT(format)                                                                               \
+    BENCHMARK_TEMPLATE(parse, format)->Apply(setFieldsCounts);                                                         \
+    BENCHMARK_TEMPLATE(bind, format, RuntimeReflCfg)->Apply(setFieldsCounts);                                          \
+    BENCHMARK_TEMPLATE(bind, format, StaticReflCfg)->Apply(setFieldsCounts);                                           \
+    BENCHMARK_TEMPLATE(read, format, RuntimeReflCfg)->Apply(setFieldsCounts);                                          \
+    BENCHMARK_TEMPLATE(read, format, StaticReflCfg)->Apply(setFieldsCounts)
+
+#ifdef FIGCONE_JSON_AVAILABLE
+FIGCONE_BENCHMARK_FORMAT(Format::Json);
+#endif
+#ifdef FIGCONE_YAML_AVAILABLE
+FIGCONE_BENCHMARK_FORMAT(Format::Yaml);
+#endif
+#ifdef FIGCONE_TOML_AVAILABLE
+FIGCONE_BENCHMARK_FORMAT(Format::Toml);
+#endif
+#ifdef FIGCONE_INI_AVAILABLE
+FIGCONE_BENCHMARK_FORMAT(Format::Ini);
+#endif
+#ifdef FIGCONE_XML_AVAILABLE
+FIGCONE_BENCHMARK_FORMAT(Format::Xml);
+#endif
+#ifdef FIGCONE_SHOAL_AVAILABLE
+FIGCONE_BENCHMARK_FORMAT(Format::Shoal);
+#endif
@@ -0,0 +1,95 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Host : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(address, std::string);
+    FIGCONE_PARAM(port, int).ensure(
+            [](int port)
+            {
+                if (port <= 0)
+                    throw figcone::ValidationError{"port must be positive"};
+            });
+    FIGCONE_PARAM(weight, double);
+    FIGCONE_PARAM(enabled, bool);
+    FIGCONE_PARAM(timeout, double)(1.0);
+    FIGCONE_PARAM(retries, int)(3);
+    FIGCONE_PARAM(zone, std::string);
+    FIGCONE_PARAM(rack, int);
+    FIGCONE_PARAM(priority, int);
+    FIGCONE_PARAM(maxConnections, int);
+    FIGCONE_PARAMLIST(tags, std::vector<std::string>)();
+};
+
+struct Inventory : public figcone::Config {
+    FIGCONE_NODELIST(hosts, std::vector<Host>);
+};
+
+std::unique_ptr<figcone::TreeNode> makeInventoryTree(int hostsCount)
+{
+    auto tree = figcone::makeTreeRoot();
+    auto& hosts = tree->asItem().addNodeList("hosts", {1, 1});
+    for (auto i = 0; i < hostsCount; ++i) {
+        auto& host = hosts.asList().emplaceBack({1, 1});
+        host.asItem().addParam("name", "host" + std::to_string(i), {1, 1});
+        host.asItem().addParam("address", "10.0.0." + std::to_string(i % 256), {1, 1});
+        host.asItem().addParam("port", std::to_string(8000 + i % 1000), {1, 1});
+        host.asItem().addParam("weight", "0.75", {1, 1});
+        host.asItem().addParam("enabled", "1", {1, 1});
+        host.asItem().addParam("timeout", "2.5", {1, 1});
+        host.asItem().addParam("zone", "zone" + std::to_string(i % 4), {1, 1});
+        host.asItem().addParam("rack", std::to_string(i % 64), {1, 1});
+        host.asItem().addParam("priority", std::to_string(i % 10), {1, 1});
+        host.asItem().addParam("maxConnections", "1024", {1, 1});
+        host.asItem().addParamList("tags", std::vector<std::string>{"a", "b"}, {1, 1});
+    }
+    return tree;
+}
+
+class TreeProvider : public figcone::IParser {
+public:
+    explicit TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+private:
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+void readLargeNodeList(benchmark::State& state)
+{
+    auto cfgReader = figcone::ConfigReader{
+            figcone::NameFormat::Original,
+            figcone::NodeListParallelism{static_cast<int>(state.range(0)), 1}};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto parser = TreeProvider{makeInventoryTree(static_cast<int>(state.range(1)))};
+        state.ResumeTiming();
+
+        auto cfg = cfgReader.read<Inventory>("", parser);
+        benchmark::DoNotOptimize(cfg);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+} //namespace
+
+BENCHMARK(readLargeNodeList)
+        ->ArgNames({"threads", "elements"})
+        ->ArgsProduct({{1, 2, 4, 8}, {1000, 50000}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,103 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/configreaderpool.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+namespace {
+
+struct FeatureFlags : public figcone::Config {
+    FIGCONE_PARAM(tenant, std::string);
+    FIGCONE_PARAM(newCheckout, bool);
+    FIGCONE_PARAM(searchV2, bool);
+    FIGCONE_PARAM(darkMode, bool);
+    FIGCONE_PARAM(rolloutPercent, int);
+    FIGCONE_PARAM(cacheTtl, double);
+};
+
+//parses configs with a "name=value" field on each line
+class FlagsParser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        auto tree = figcone::makeTreeRoot();
+        auto line = std::string{};
+        while (std::getline(stream, line)) {
+            const auto delimPos = line.find('=');
+            if (delimPos != std::string::npos)
+                tree->asItem().addParam(line.substr(0, delimPos), line.substr(delimPos + 1), {1, 1});
+        }
+        return tree;
+    }
+};
+
+const auto flagsContent = std::string{"tenant=acme\n"
+                                      "newCheckout=1\n"
+                                      "searchV2=0\n"
+                                      "darkMode=1\n"
+                                      "rolloutPercent=25\n"
+                                      "cacheTtl=1.5\n"};
+
+void readFlagsWithNewReader(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto cfgReader = figcone::ConfigReader{};
+        auto parser = FlagsParser{};
+        auto cfg = cfgReader.read<FeatureFlags>(flagsContent, parser);
+        benchmark::DoNotOptimize(cfg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void readFlagsWithReaderPool(benchmark::State& state)
+{
+    static auto readerPool = figcone::ConfigReaderPool{[]
+                                                       {
+                                                           return std::make_unique<FlagsParser>();
+                                                       }};
+    for (auto _ : state) {
+        auto cfg = readerPool.read<FeatureFlags>(flagsContent);
+        benchmark::DoNotOptimize(cfg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#ifdef FIGCONE_JSON_AVAILABLE
+const auto flagsJsonContent = std::string{R"({"tenant": "acme", "newCheckout": true, "searchV2": false, )"
+                                          R"("darkMode": true, "rolloutPercent": 25, "cacheTtl": 1.5})"};
+
+void readJsonFlagsWithNewReader(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto cfgReader = figcone::ConfigReader{};
+        auto cfg = cfgReader.readJson<FeatureFlags>(flagsJsonContent);
+        benchmark::DoNotOptimize(cfg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void readJsonFlagsWithReaderPool(benchmark::State& state)
+{
+    static auto readerPool = figcone::ConfigReaderPool{[]
+                                                       {
+                                                           return std::make_unique<figcone::json::Parser>();
+                                                       }};
+    for (auto _ : state) {
+        auto cfg = readerPool.read<FeatureFlags>(flagsJsonContent);
+        benchmark::DoNotOptimize(cfg);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+#endif
+
+} //namespace
+
+BENCHMARK(readFlagsWithNewReader)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(readFlagsWithReaderPool)->ThreadRange(1, 8)->UseRealTime();
+#ifdef FIGCONE_JSON_AVAILABLE
+BENCHMARK(readJsonFlagsWithNewReader)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(readJsonFlagsWithReaderPool)->ThreadRange(1, 8)->UseRealTime();
+#endif
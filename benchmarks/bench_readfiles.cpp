@@ -0,0 +1,110 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef FIGCONE_JSON_AVAILABLE
+
+namespace {
+
+struct Record : public figcone::Config {
+    FIGCONE_PARAM(id, int);
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(port, int);
+    FIGCONE_PARAM(weight, double);
+};
+
+struct TenantCfg : public figcone::Config {
+    FIGCONE_NODELIST(records, std::vector<Record>);
+};
+
+constexpr auto tenantCount = 3000;
+constexpr auto recordsPerTenant = 20;
+
+class TenantConfigFiles {
+public:
+    TenantConfigFiles()
+        : configDir_{std::filesystem::temp_directory_path() / "figcone_bench_readfiles"}
+    {
+        std::filesystem::create_directories(configDir_);
+        for (auto tenant = 0; tenant < tenantCount; ++tenant) {
+            auto config = std::string{"{\"records\": ["};
+            for (auto i = 0; i < recordsPerTenant; ++i) {
+                const auto number = std::to_string(i);
+                config += i ? ",\n{" : "\n{";
+                config += "\"id\": " + number + ", \"name\": \"record" + number + "\", \"host\": \"10.0." +
+                        std::to_string(tenant % 256) + ".1\", \"port\": " + std::to_string(8000 + i) +
+                        ", \"weight\": 0.75}";
+            }
+            config += "]}";
+
+            configFiles_.emplace_back(configDir_ / ("tenant" + std::to_string(tenant) + ".json"));
+            auto stream = std::ofstream{configFiles_.back(), std::ios_base::binary};
+            stream << config;
+        }
+    }
+
+    ~TenantConfigFiles()
+    {
+        std::filesystem::remove_all(configDir_);
+    }
+
+    TenantConfigFiles(const TenantConfigFiles&) = delete;
+    TenantConfigFiles& operator=(const TenantConfigFiles&) = delete;
+
+    const std::vector<std::filesystem::path>& configFiles() const
+    {
+        return configFiles_;
+    }
+
+private:
+    std::filesystem::path configDir_;
+    std::vector<std::filesystem::path> configFiles_;
+};
+
+void readFilesSequentially(benchmark::State& state)
+{
+    const auto files = TenantConfigFiles{};
+    auto cfgReader = figcone::ConfigReader{};
+    for (auto _ : state) {
+        auto cfgs = std::vector<TenantCfg>{};
+        for (const auto& configFile : files.configFiles())
+            cfgs.emplace_back(cfgReader.readJsonFile<TenantCfg>(configFile));
+        benchmark::DoNotOptimize(cfgs);
+    }
+    state.SetItemsProcessed(state.iterations() * tenantCount);
+}
+
+void readFiles(benchmark::State& state)
+{
+    const auto files = TenantConfigFiles{};
+    auto cfgReader = figcone::ConfigReader{};
+    for (auto _ : state) {
+        auto results = cfgReader.readFiles<TenantCfg>(
+                files.configFiles(),
+                []
+                {
+                    return std::make_unique<figcone::json::Parser>();
+                },
+                static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(state.iterations() * tenantCount);
+}
+
+} //namespace
+
+BENCHMARK(readFilesSequentially)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(readFiles)
+        ->ArgName("threads")
+        ->RangeMultiplier(2)
+        ->Range(1, 16)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+
+#endif
\ No newline at end of file
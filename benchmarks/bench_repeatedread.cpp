@@ -0,0 +1,94 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Endpoint : public figcone::Config {
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(port, int);
+    FIGCONE_PARAM(timeout, double)(1.0);
+    FIGCONE_PARAM(retries, int)(3);
+    FIGCONE_PARAMLIST(tags, std::vector<std::string>)();
+};
+
+struct Tenant : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(enabled, bool);
+    FIGCONE_NODE(primary, Endpoint);
+    FIGCONE_NODE(fallback, figcone::optional<Endpoint>);
+    FIGCONE_NODELIST(endpoints, std::vector<Endpoint>);
+};
+
+void addEndpoint(figcone::TreeNode& node, int index)
+{
+    node.asItem().addParam("host", "host" + std::to_string(index), {1, 1});
+    node.asItem().addParam("port", std::to_string(8000 + index), {1, 1});
+    node.asItem().addParam("timeout", "2.5", {1, 1});
+    node.asItem().addParamList("tags", std::vector<std::string>{"a", "b"}, {1, 1});
+}
+
+std::unique_ptr<figcone::TreeNode> makeTenantTree(int endpointsCount)
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "tenant", {1, 1});
+    tree->asItem().addParam("enabled", "1", {1, 1});
+    addEndpoint(tree->asItem().addNode("primary", {1, 1}), 0);
+    addEndpoint(tree->asItem().addNode("fallback", {1, 1}), 1);
+    auto& endpoints = tree->asItem().addNodeList("endpoints", {1, 1});
+    for (auto i = 0; i < endpointsCount; ++i)
+        addEndpoint(endpoints.asList().emplaceBack({1, 1}), i);
+    return tree;
+}
+
+class TreeProvider : public figcone::IParser {
+public:
+    explicit TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+private:
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+void readWithNewReader(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto parser = TreeProvider{makeTenantTree(static_cast<int>(state.range(0)))};
+        state.ResumeTiming();
+
+        auto cfgReader = figcone::ConfigReader{};
+        auto cfg = cfgReader.read<Tenant>("", parser);
+        benchmark::DoNotOptimize(cfg);
+    }
+}
+
+void readWithSameReader(benchmark::State& state)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto parser = TreeProvider{makeTenantTree(static_cast<int>(state.range(0)))};
+        state.ResumeTiming();
+
+        auto cfg = cfgReader.read<Tenant>("", parser);
+        benchmark::DoNotOptimize(cfg);
+    }
+}
+
+} //namespace
+
+BENCHMARK(readWithNewReader)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(readWithSameReader)->RangeMultiplier(10)->Range(1, 10000);
@@ -0,0 +1,152 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Record : public figcone::Config {
+    FIGCONE_PARAM(id, int);
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(port, int);
+    FIGCONE_PARAM(weight, double);
+    FIGCONE_PARAM(enabled, bool);
+    FIGCONE_PARAM(timeout, double);
+    FIGCONE_PARAM(retries, int);
+    FIGCONE_PARAM(zone, std::string);
+    FIGCONE_PARAM(priority, int);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_NODELIST(records, std::vector<Record>);
+};
+
+std::string makeJsonConfig(int recordsCount)
+{
+    auto result = std::string{"{\"records\": ["};
+    for (auto i = 0; i < recordsCount; ++i) {
+        const auto number = std::to_string(i);
+        result += i ? ",\n{" : "\n{";
+        result += "\"id\": " + number + ", \"name\": \"record" + number + "\", \"host\": \"10.0." +
+                std::to_string(i % 256) + ".1\", \"port\": " + std::to_string(8000 + i % 1000) +
+                ", \"weight\": 0.75, \"enabled\": 1, \"timeout\": 2.5, \"retries\": " + std::to_string(i % 5) +
+                ", \"zone\": \"zone" + std::to_string(i % 4) + "\", \"priority\": " + std::to_string(i % 10) + "}";
+    }
+    result += "]}";
+    return result;
+}
+
+std::string makeYamlConfig(int recordsCount)
+{
+    auto result = std::string{"records:\n"};
+    for (auto i = 0; i < recordsCount; ++i) {
+        const auto number = std::to_string(i);
+        result += "  - id: " + number + "\n    name: record" + number + "\n    host: 10.0." +
+                std::to_string(i % 256) + ".1\n    port: " + std::to_string(8000 + i % 1000) +
+                "\n    weight: 0.75\n    enabled: 1\n    timeout: 2.5\n    retries: " + std::to_string(i % 5) +
+                "\n    zone: zone" + std::to_string(i % 4) + "\n    priority: " + std::to_string(i % 10) + "\n";
+    }
+    return result;
+}
+
+class ConfigFiles {
+public:
+    ConfigFiles(const std::string& name, const std::string& config)
+        : configFile_{std::filesystem::temp_directory_path() / ("figcone_bench_snapshot_" + name)}
+        , snapshotFile_{std::filesystem::temp_directory_path() / ("figcone_bench_snapshot_" + name + ".snapshot")}
+    {
+        auto stream = std::ofstream{configFile_, std::ios_base::binary};
+        stream << config;
+    }
+
+    ~ConfigFiles()
+    {
+        std::filesystem::remove(configFile_);
+        std::filesystem::remove(snapshotFile_);
+    }
+
+    ConfigFiles(const ConfigFiles&) = delete;
+    ConfigFiles& operator=(const ConfigFiles&) = delete;
+
+    const std::filesystem::path& configFile() const
+    {
+        return configFile_;
+    }
+
+    const std::filesystem::path& snapshotFile() const
+    {
+        return snapshotFile_;
+    }
+
+private:
+    std::filesystem::path configFile_;
+    std::filesystem::path snapshotFile_;
+};
+
+template<typename TParser>
+void readFile(benchmark::State& state, const std::string& config)
+{
+    const auto files = ConfigFiles{std::to_string(state.range(0)), config};
+    auto cfgReader = figcone::ConfigReader{};
+    for (auto _ : state) {
+        auto parser = TParser{};
+        auto cfg = cfgReader.readFile<Cfg>(files.configFile(), parser);
+        benchmark::DoNotOptimize(cfg);
+    }
+}
+
+template<typename TParser>
+void readFileFromSnapshot(benchmark::State& state, const std::string& config)
+{
+    const auto files = ConfigFiles{std::to_string(state.range(0)), config};
+    auto cfgReader = figcone::ConfigReader{};
+    {
+        auto parser = TParser{};
+        cfgReader.readFile<Cfg>(files.configFile(), parser, files.snapshotFile());
+    }
+    for (auto _ : state) {
+        auto parser = TParser{};
+        auto cfg = cfgReader.readFile<Cfg>(files.configFile(), parser, files.snapshotFile());
+        benchmark::DoNotOptimize(cfg);
+    }
+}
+
+#ifdef FIGCONE_JSON_AVAILABLE
+void readJsonFile(benchmark::State& state)
+{
+    readFile<figcone::json::Parser>(state, makeJsonConfig(static_cast<int>(state.range(0))));
+}
+
+void readJsonFileFromSnapshot(benchmark::State& state)
+{
+    readFileFromSnapshot<figcone::json::Parser>(state, makeJsonConfig(static_cast<int>(state.range(0))));
+}
+#endif
+
+#ifdef FIGCONE_YAML_AVAILABLE
+void readYamlFile(benchmark::State& state)
+{
+    readFile<figcone::yaml::Parser>(state, makeYamlConfig(static_cast<int>(state.range(0))));
+}
+
+void readYamlFileFromSnapshot(benchmark::State& state)
+{
+    readFileFromSnapshot<figcone::yaml::Parser>(state, makeYamlConfig(static_cast<int>(state.range(0))));
+}
+#endif
+
+} //namespace
+
+#ifdef FIGCONE_JSON_AVAILABLE
+BENCHMARK(readJsonFile)->ArgName("records")->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(readJsonFileFromSnapshot)->ArgName("records")->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+#endif
+
+#ifdef FIGCONE_YAML_AVAILABLE
+BENCHMARK(readYamlFile)->ArgName("records")->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(readYamlFileFromSnapshot)->ArgName("records")->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+#endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/detail/stringconverter.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <benchmark/benchmark.h>
+#include <istream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+//wraps a value to force reading it with the stringstream based conversion
+template<typename T>
+struct Streamed {
+    T value;
+};
+
+template<typename T>
+std::istream& operator>>(std::istream& stream, Streamed<T>& streamed)
+{
+    return stream >> streamed.value;
+}
+
+template<typename TInt, typename TDouble>
+struct NumericCfg : public figcone::Config {
+    FIGCONE_PARAMLIST(ints, std::vector<TInt>);
+    FIGCONE_PARAMLIST(doubles, std::vector<TDouble>);
+};
+
+using FromCharsCfg = NumericCfg<int, double>;
+using StringStreamCfg = NumericCfg<Streamed<int>, Streamed<double>>;
+
+std::vector<std::string> makeInts(int size)
+{
+    auto result = std::vector<std::string>{};
+    for (auto i = 0; i < size; ++i)
+        result.emplace_back(std::to_string(i * 7919 - 500000));
+    return result;
+}
+
+std::vector<std::string> makeDoubles(int size)
+{
+    auto result = std::vector<std::string>{};
+    for (auto i = 0; i < size; ++i)
+        result.emplace_back(std::to_string(i * 0.37 - 1000.0));
+    return result;
+}
+
+class TreeProvider : public figcone::IParser {
+public:
+    explicit TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+private:
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+template<typename T>
+void convertValue(benchmark::State& state, const std::vector<std::string>& values)
+{
+    for (auto _ : state)
+        for (const auto& value : values)
+            benchmark::DoNotOptimize(figcone::detail::convertFromString<T>(value));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+
+void convertIntWithFromChars(benchmark::State& state)
+{
+    convertValue<int>(state, makeInts(1000));
+}
+
+void convertIntWithStringStream(benchmark::State& state)
+{
+    convertValue<Streamed<int>>(state, makeInts(1000));
+}
+
+void convertDoubleWithFromChars(benchmark::State& state)
+{
+    convertValue<double>(state, makeDoubles(1000));
+}
+
+void convertDoubleWithStringStream(benchmark::State& state)
+{
+    convertValue<Streamed<double>>(state, makeDoubles(1000));
+}
+
+template<typename TCfg>
+void readNumericConfig(benchmark::State& state)
+{
+    const auto size = static_cast<int>(state.range(0));
+    auto cfgReader = figcone::ConfigReader{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto tree = figcone::makeTreeRoot();
+        tree->asItem().addParamList("ints", makeInts(size), {1, 1});
+        tree->asItem().addParamList("doubles", makeDoubles(size), {2, 1});
+        auto parser = TreeProvider{std::move(tree)};
+        state.ResumeTiming();
+
+        auto cfg = cfgReader.read<TCfg>("", parser);
+        benchmark::DoNotOptimize(cfg);
+    }
+    state.SetItemsProcessed(state.iterations() * size * 2);
+}
+
+void readNumericConfigWithFromChars(benchmark::State& state)
+{
+    readNumericConfig<FromCharsCfg>(state);
+}
+
+void readNumericConfigWithStringStream(benchmark::State& state)
+{
+    readNumericConfig<StringStreamCfg>(state);
+}
+
+} //namespace
+
+BENCHMARK(convertIntWithFromChars);
+BENCHMARK(convertIntWithStringStream);
+BENCHMARK(convertDoubleWithFromChars);
+BENCHMARK(convertDoubleWithStringStream);
+BENCHMARK(readNumericConfigWithFromChars)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK(readNumericConfigWithStringStream)->RangeMultiplier(10)->Range(10, 10000);
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "detail/inode.h"
 #include "detail/ivalidator.h"
 #include "detail/nameof_import.h"
+#include "detail/nameutils.h"
 #include "detail/nodecreator.h"
 #include "detail/nodelistcreator.h"
 #include "detail/paramcreator.h"
@@ -22,6 +23,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace figcone {
@@ -46,42 +48,78 @@ public:
 
 protected:
     template<auto member>
-    auto node(const std::string& memberName)
+    auto node(std::string_view memberName)
+    {
+        return node<member>(detail::FieldName{memberName});
+    }
+
+    template<auto member>
+    auto node(const detail::FieldName& memberName)
     {
         auto ptr = decltype(member){};
         return node<member>(ptr, memberName);
     }
 
     template<auto member>
-    auto dict(const std::string& memberName)
+    auto dict(std::string_view memberName)
+    {
+        return dict<member>(detail::FieldName{memberName});
+    }
+
+    template<auto member>
+    auto dict(const detail::FieldName& memberName)
     {
         auto ptr = decltype(member){};
         return dict<member>(ptr, memberName);
     }
 
     template<auto member>
-    auto nodeList(const std::string& memberName)
+    auto nodeList(std::string_view memberName)
+    {
+        return nodeList<member>(detail::FieldName{memberName});
+    }
+
+    template<auto member>
+    auto nodeList(const detail::FieldName& memberName)
     {
         auto ptr = decltype(member){};
         return nodeList<member>(ptr, memberName);
     }
 
     template<auto member>
-    auto copyNodeList(const std::string& memberName)
+    auto copyNodeList(std::string_view memberName)
+    {
+        return copyNodeList<member>(detail::FieldName{memberName});
+    }
+
+    template<auto member>
+    auto copyNodeList(const detail::FieldName& memberName)
     {
         auto ptr = decltype(member){};
         return copyNodeList<member>(ptr, memberName);
     }
 
     template<auto member>
-    auto param(const std::string& memberName)
+    auto param(std::string_view memberName)
+    {
+        return param<member>(detail::FieldName{memberName});
+    }
+
+    template<auto member>
+    auto param(const detail::FieldName& memberName)
     {
         auto ptr = decltype(member){};
         return param<member>(ptr, memberName);
     }
 
     template<auto member>
-    auto paramList(const std::string& memberName)
+    auto paramList(std::string_view memberName)
+    {
+        return paramList<member>(detail::FieldName{memberName});
+    }
+
+    template<auto member>
+    auto paramList(const detail::FieldName& memberName)
     {
         auto ptr = decltype(member){};
         return paramList<member>(ptr, memberName);
@@ -91,37 +129,47 @@ protected:
     template<auto member>
     auto node()
     {
-        return node<member>(std::string{nameof::nameof_member<member>()});
+        return node<member>(detail::FieldName{nameof::nameof_member<member>(), &convertedMemberName<member>});
     }
 
     template<auto member>
     auto dict()
     {
-        return dict<member>(std::string{nameof::nameof_member<member>()});
+        return dict<member>(detail::FieldName{nameof::nameof_member<member>(), &convertedMemberName<member>});
     }
 
     template<auto member>
     auto nodeList()
     {
-        return nodeList<member>(std::string{nameof::nameof_member<member>()});
+        return nodeList<member>(detail::FieldName{nameof::nameof_member<member>(), &convertedMemberName<member>});
     }
 
     template<auto member>
     auto copyNodeList()
     {
-        return copyNodeList<member>(std::string{nameof::nameof_member<member>()});
+        return copyNodeList<member>(detail::FieldName{nameof::nameof_member<member>(), &convertedMemberName<member>});
     }
 
     template<auto member>
     auto param()
     {
-        return param<member>(std::string{nameof::nameof_member<member>()});
+        return param<member>(detail::FieldName{nameof::nameof_member<member>(), &convertedMemberName<member>});
     }
 
     template<auto member>
     auto paramList()
     {
-        return paramList<member>(std::string{nameof::nameof_member<member>()});
+        return paramList<member>(detail::FieldName{nameof::nameof_member<member>(), &convertedMemberName<member>});
+    }
+#endif
+
+#ifdef FIGCONE_NAMEOF_AVAILABLE
+    template<auto member>
+    static std::string_view convertedMemberName(NameFormat nameFormat)
+    {
+        static constexpr auto names =
+                detail::ConvertedNames<nameof::nameof_member<member>().size()>{nameof::nameof_member<member>()};
+        return names.get(nameFormat);
     }
 #endif
 
@@ -132,42 +180,42 @@ protected:
 
 private:
     template<auto member, typename T, typename TCfg>
-    auto node(T TCfg::*, const std::string& memberName)
+    auto node(T TCfg::*, const detail::FieldName& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
         return detail::NodeCreator<T>{cfgReader(), memberName, cfg->*member};
     }
 
     template<auto member, typename TMap, typename TCfg>
-    auto dict(TMap TCfg::*, const std::string& memberName)
+    auto dict(TMap TCfg::*, const detail::FieldName& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
         return detail::DictCreator<TMap>{cfgReader(), memberName, cfg->*member};
     }
 
     template<auto member, typename TCfgList, typename TCfg>
-    auto nodeList(TCfgList TCfg::*, const std::string& memberName)
+    auto nodeList(TCfgList TCfg::*, const detail::FieldName& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
         return detail::NodeListCreator<TCfgList>{cfgReader(), memberName, cfg->*member};
     }
 
     template<auto member, typename TCfgList, typename TCfg>
-    auto copyNodeList(TCfgList TCfg::*, const std::string& memberName)
+    auto copyNodeList(TCfgList TCfg::*, const detail::FieldName& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
         return detail::NodeListCreator<TCfgList>{cfgReader(), memberName, cfg->*member, detail::NodeListType::Copy};
     }
 
     template<auto member, typename T, typename TCfg>
-    auto param(T TCfg::*, const std::string& memberName)
+    auto param(T TCfg::*, const detail::FieldName& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
         return detail::ParamCreator<T>{cfgReader(), memberName, cfg->*member};
     }
 
     template<auto member, typename T, typename TCfg>
-    auto paramList(T TCfg::*, const std::string& memberName)
+    auto paramList(T TCfg::*, const detail::FieldName& memberName)
     {
         auto cfg = static_cast<TCfg*>(this);
         return detail::ParamListCreator<T>{cfgReader(), memberName, cfg->*member};
@@ -0,0 +1,13 @@
+#ifndef FIGCONE_CONFIGLISTFORMAT_H
+#define FIGCONE_CONFIGLISTFORMAT_H
+
+namespace figcone {
+
+enum class ConfigListFormat {
+    Json, //JSON array of configs or newline-delimited JSON documents
+    Yaml, //YAML documents separated with '---'
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_CONFIGLISTFORMAT_H
\ No newline at end of file
@@ -0,0 +1,264 @@
+#ifndef FIGCONE_CONFIGOVERLAY_H
+#define FIGCONE_CONFIGOVERLAY_H
+
+#include "errors.h"
+#include "overlayfieldmatching.h"
+#include "detail/nameutils.h"
+#include <figcone_tree/tree.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+extern "C" char** environ;
+#endif
+
+namespace figcone {
+class ConfigReader;
+}
+
+namespace figcone::detail {
+
+//Fields added by the same call of ConfigOverlay belong to the same source group, which can't override a field twice
+struct OverlayParam {
+    std::string name;
+    std::string value;
+    std::string source;
+    std::string path;
+    int sourceGroup = 0;
+    OverlayFieldMatching matching = OverlayFieldMatching::Strict;
+};
+
+struct OverlayNode {
+    std::string name;
+    std::string source;
+    std::vector<OverlayParam> params;
+    std::vector<OverlayNode> nodes;
+    int sourceGroup = 0;
+    OverlayFieldMatching matching = OverlayFieldMatching::Strict;
+};
+
+//Overlay field names are matched with the registered names ignoring the case and the '_' and '-' separators,
+//so "POOL_SIZE", "pool-size" and "poolSize" all match the same field
+inline std::string overlayFieldKey(std::string_view name)
+{
+    auto result = std::string{};
+    for (auto ch : name)
+        if (ch != '_' && ch != '-')
+            result.push_back(toLower(ch));
+    return result;
+}
+
+inline std::string_view trimOverlayValue(std::string_view str)
+{
+    while (!str.empty() && str.front() == ' ')
+        str.remove_prefix(1);
+    while (!str.empty() && str.back() == ' ')
+        str.remove_suffix(1);
+    return str;
+}
+
+//Values of parameter lists in the "[a, b, c]" format are split into elements, "\," and "\\" in the elements are
+//replaced with ',' and '\'. Values of parameters are used as is, so they can contain brackets and commas.
+inline TreeParam makeOverlayTreeParam(std::string_view value, bool isList)
+{
+    if (!isList || value.size() < 2 || value.front() != '[' || value.back() != ']')
+        return TreeParam{std::string{value}};
+
+    auto valueList = std::vector<std::string>{};
+    const auto listContent = trimOverlayValue(value.substr(1, value.size() - 2));
+    if (listContent.empty())
+        return TreeParam{std::move(valueList)};
+
+    auto element = std::string{};
+    for (auto pos = std::size_t{}; pos < listContent.size(); ++pos) {
+        const auto ch = listContent[pos];
+        const auto isEscape = ch == '\\' && pos + 1 < listContent.size() &&
+                (listContent[pos + 1] == ',' || listContent[pos + 1] == '\\');
+        if (isEscape)
+            element.push_back(listContent[++pos]);
+        else if (ch == ',') {
+            valueList.emplace_back(trimOverlayValue(element));
+            element.clear();
+        }
+        else
+            element.push_back(ch);
+    }
+    valueList.emplace_back(trimOverlayValue(element));
+    return TreeParam{std::move(valueList)};
+}
+
+} //namespace figcone::detail
+
+namespace figcone {
+
+//Values of config fields overriding the ones from the config files.
+//Fields are specified by paths of names separated by dots, for example "database.poolSize".
+//Values of parameter lists are specified in the "[a, b, c]" format, commas in their elements are escaped as "\,".
+class ConfigOverlay {
+public:
+    void set(std::string_view fieldPath, std::string_view value)
+    {
+        ++sourceGroupCount_;
+        set(fieldPath, ".", value, "Overlay field '" + std::string{fieldPath} + "'", OverlayFieldMatching::Strict);
+    }
+
+    //Adds environment variables starting with prefix, remaining parts of the names separated by the separator
+    //form the field path, for example "APP_DATABASE__POOL_SIZE" with the "APP_" prefix overrides "database.poolSize".
+    //By default, variables that don't match any config field are ignored, as the environment can contain unrelated
+    //variables with the same prefix. Variables overriding the same field, like "APP_POOL_SIZE" and "APP_POOLSIZE",
+    //cause ConfigError.
+    void addEnvironment(
+            std::string_view prefix,
+            std::string_view separator = "__",
+            OverlayFieldMatching matching = OverlayFieldMatching::IgnoreUnmatched)
+    {
+        ++sourceGroupCount_;
+#ifdef _WIN32
+        auto variables = _environ;
+#else
+        auto variables = environ;
+#endif
+        for (; variables && *variables; ++variables) {
+            const auto variable = std::string_view{*variables};
+            const auto delimPos = variable.find('=');
+            if (delimPos == std::string_view::npos || variable.substr(0, prefix.size()) != prefix)
+                continue;
+
+            const auto name = variable.substr(0, delimPos);
+            set(name.substr(prefix.size()),
+                separator,
+                variable.substr(delimPos + 1),
+                "Environment variable '" + std::string{name} + "'",
+                matching);
+        }
+    }
+
+    //Adds command line arguments in the "--field.path=value" format, other arguments are ignored
+    void addCommandLine(int argc, const char* const* argv, std::string_view prefix = "--")
+    {
+        ++sourceGroupCount_;
+        for (auto i = 1; i < argc; ++i) {
+            const auto argument = std::string_view{argv[i]};
+            const auto delimPos = argument.find('=');
+            if (delimPos == std::string_view::npos || argument.substr(0, prefix.size()) != prefix)
+                continue;
+
+            set(argument.substr(prefix.size(), delimPos - prefix.size()),
+                ".",
+                argument.substr(delimPos + 1),
+                "Command line argument '" + std::string{argument} + "'",
+                OverlayFieldMatching::Strict);
+        }
+    }
+
+    bool empty() const
+    {
+        return root_.params.empty() && root_.nodes.empty();
+    }
+
+private:
+    void set(
+            std::string_view fieldPath,
+            std::string_view separator,
+            std::string_view value,
+            const std::string& source,
+            OverlayFieldMatching matching)
+    {
+        auto names = std::vector<std::string>{};
+        for (auto pos = std::size_t{};;) {
+            const auto separatorPos = fieldPath.find(separator, pos);
+            names.emplace_back(fieldPath.substr(pos, separatorPos - pos));
+            if (names.back().empty())
+                throw ConfigError{source + " has an empty field name"};
+            if (separatorPos == std::string_view::npos)
+                break;
+            pos = separatorPos + separator.size();
+        }
+
+        auto node = &root_;
+        for (auto it = names.begin(); it != std::prev(names.end()); ++it) {
+            auto param = findParam(*node, *it);
+            if (param != node->params.end() && param->sourceGroup == sourceGroupCount_)
+                throwConflict(param->source, source);
+
+            auto nestedNode = findNode(*node, *it);
+            if (nestedNode == node->nodes.end())
+                nestedNode = node->nodes.insert(
+                        node->nodes.end(),
+                        detail::OverlayNode{*it, source, {}, {}, sourceGroupCount_, matching});
+            if (nestedNode->sourceGroup != sourceGroupCount_) {
+                nestedNode->source = source;
+                nestedNode->sourceGroup = sourceGroupCount_;
+            }
+            if (matching == OverlayFieldMatching::Strict)
+                nestedNode->matching = OverlayFieldMatching::Strict;
+            node = &*nestedNode;
+        }
+
+        auto nestedNode = findNode(*node, names.back());
+        if (nestedNode != node->nodes.end() && nestedNode->sourceGroup == sourceGroupCount_)
+            throwConflict(nestedNode->source, source);
+
+        auto overlayParam = detail::OverlayParam{
+                names.back(),
+                std::string{value},
+                source,
+                std::string{fieldPath},
+                sourceGroupCount_,
+                matching};
+        auto param = findParam(*node, names.back());
+        if (param == node->params.end()) {
+            node->params.emplace_back(std::move(overlayParam));
+            return;
+        }
+        if (param->sourceGroup == sourceGroupCount_ && param->path != fieldPath)
+            throwConflict(param->source, source);
+        *param = std::move(overlayParam);
+    }
+
+    static std::vector<detail::OverlayParam>::iterator findParam(detail::OverlayNode& node, const std::string& name)
+    {
+        return std::find_if(
+                node.params.begin(),
+                node.params.end(),
+                [&](const detail::OverlayParam& overlayParam)
+                {
+                    return detail::overlayFieldKey(overlayParam.name) == detail::overlayFieldKey(name);
+                });
+    }
+
+    static std::vector<detail::OverlayNode>::iterator findNode(detail::OverlayNode& node, const std::string& name)
+    {
+        return std::find_if(
+                node.nodes.begin(),
+                node.nodes.end(),
+                [&](const detail::OverlayNode& nestedNode)
+                {
+                    return detail::overlayFieldKey(nestedNode.name) == detail::overlayFieldKey(name);
+                });
+    }
+
+    static void throwConflict(const std::string& source, const std::string& conflictingSource)
+    {
+        throw ConfigError{"Overlay fields override the same config field: " + source + ", " + conflictingSource};
+    }
+
+    const detail::OverlayNode& root() const
+    {
+        return root_;
+    }
+
+private:
+    detail::OverlayNode root_;
+    int sourceGroupCount_ = 0;
+    friend class ConfigReader;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_CONFIGOVERLAY_H
\ No newline at end of file
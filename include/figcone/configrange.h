@@ -0,0 +1,185 @@
+#ifndef FIGCONE_CONFIGRANGE_H
+#define FIGCONE_CONFIGRANGE_H
+
+#include "configlistformat.h"
+#include "errors.h"
+#include "detail/configlistsplitter.h"
+#include <figcone_tree/streamposition.h>
+#include <charconv>
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace figcone {
+class ConfigReader;
+
+//Input range reading configs from a stream of multiple configs one at a time.
+//The range reads configs with the ConfigReader that created it, so the reader must outlive the range. Moving the range
+//invalidates its iterators.
+template<typename TCfg>
+class ConfigRange {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = TCfg;
+        using difference_type = std::ptrdiff_t;
+        using pointer = TCfg*;
+        using reference = TCfg&;
+
+        Iterator() = default;
+
+        reference operator*() const
+        {
+            return *range_->cfg_;
+        }
+
+        pointer operator->() const
+        {
+            return &*range_->cfg_;
+        }
+
+        Iterator& operator++()
+        {
+            range_->readNext();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.isEnd() == rhs.isEnd();
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        explicit Iterator(ConfigRange* range)
+            : range_{range}
+        {
+        }
+
+        bool isEnd() const
+        {
+            return !range_ || !range_->cfg_;
+        }
+
+    private:
+        ConfigRange* range_ = nullptr;
+        friend class ConfigRange;
+    };
+
+    ConfigRange(const ConfigRange&) = delete;
+    ConfigRange& operator=(const ConfigRange&) = delete;
+    ConfigRange(ConfigRange&&) = default;
+    ConfigRange& operator=(ConfigRange&&) = default;
+
+    Iterator begin()
+    {
+        if (!isStarted_) {
+            isStarted_ = true;
+            readNext();
+        }
+        return Iterator{this};
+    }
+
+    Iterator end()
+    {
+        return Iterator{};
+    }
+
+private:
+    using ConfigParser = std::function<TCfg(std::istream&)>;
+
+    ConfigRange(
+            std::istream& stream,
+            ConfigListFormat format,
+            ConfigParser configParser,
+            std::unique_ptr<std::istream> ownedStream = nullptr)
+        : ownedStream_{std::move(ownedStream)}
+        , stream_{&stream}
+        , splitter_{format}
+        , configParser_{std::move(configParser)}
+    {
+    }
+
+    void readNext()
+    {
+        cfg_.reset();
+        auto element = splitter_.next(*stream_);
+        if (!element)
+            return;
+
+        auto elementStream = std::istringstream{std::move(element->text)};
+        try {
+            cfg_.emplace(configParser_(elementStream));
+        }
+        catch (const ConfigError& e) {
+            throw makeElementError(e.what(), element->position);
+        }
+    }
+
+    //Moves the position of the element parsing error from the element's text to the stream of the list
+    static ConfigError makeElementError(std::string_view errorMessage, const StreamPosition& elementPosition)
+    {
+        auto line = 0;
+        auto column = 0;
+        auto position = elementPosition;
+        if (elementPosition.line && elementPosition.column && readErrorPosition(errorMessage, line, column))
+            position = StreamPosition{
+                    *elementPosition.line + line - 1,
+                    line == 1 ? *elementPosition.column + column - 1 : column};
+        return ConfigError{"Config list element: " + std::string{errorMessage}, position};
+    }
+
+    //reads the "[line:1, column:1] " prefix of the error message and removes it from the message
+    static bool readErrorPosition(std::string_view& errorMessage, int& line, int& column)
+    {
+        auto text = errorMessage;
+        if (!readErrorPositionPart(text, "[line:", line) || !readErrorPositionPart(text, ", column:", column) ||
+            text.substr(0, 2) != "] ")
+            return false;
+        errorMessage = text.substr(2);
+        return true;
+    }
+
+    static bool readErrorPositionPart(std::string_view& text, std::string_view prefix, int& value)
+    {
+        if (text.substr(0, prefix.size()) != prefix)
+            return false;
+        text.remove_prefix(prefix.size());
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (result.ec != std::errc{})
+            return false;
+        text.remove_prefix(static_cast<std::size_t>(result.ptr - text.data()));
+        return true;
+    }
+
+private:
+    std::unique_ptr<std::istream> ownedStream_;
+    std::istream* stream_;
+    detail::ConfigListSplitter splitter_;
+    ConfigParser configParser_;
+    std::optional<TCfg> cfg_;
+    bool isStarted_ = false;
+    friend class ConfigReader;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_CONFIGRANGE_H
\ No newline at end of file
@@ -1,16 +1,32 @@
 #ifndef FIGCONE_CONFIGREADER_H
 #define FIGCONE_CONFIGREADER_H
 
+#include "configlistformat.h"
+#include "configoverlay.h"
+#include "configrange.h"
 #include "errors.h"
+#include "executor.h"
+#include "ibufferparser.h"
+#include "listmergemode.h"
 #include "nameformat.h"
+#include "nodelistparallelism.h"
+#include "overlayfieldmatching.h"
 #include "postprocessor.h"
+#include "readfileresult.h"
+#include "treecache.h"
 #include "unregisteredfieldhandler.h"
+#include "validatorparallelism.h"
+#include "detail/asynctask.h"
 #include "detail/configreaderptr.h"
+#include "detail/configschemapool.h"
+#include "detail/configsnapshot.h"
 #include "detail/creatormode.h"
+#include "detail/decompressingstream.h"
 #include "detail/dictcreator.h"
 #include "detail/external/eel/path.h"
 #include "detail/external/eel/type_traits.h"
 #include "detail/external/pfr.hpp"
+#include "detail/fieldindex.h"
 #include "detail/fieldtraits.h"
 #include "detail/figcone_ini_import.h"
 #include "detail/figcone_json_import.h"
@@ -22,21 +38,37 @@
 #include "detail/iparam.h"
 #include "detail/ivalidator.h"
 #include "detail/loadingerror.h"
+#include "detail/mappedfile.h"
 #include "detail/nameutils.h"
 #include "detail/nodecreator.h"
 #include "detail/nodelistcreator.h"
+#include "detail/parallelfor.h"
 #include "detail/paramcreator.h"
 #include "detail/paramlistcreator.h"
+#include "detail/snapshotdata.h"
+#include "detail/treediff.h"
+#include "detail/treemerger.h"
+#include "detail/treesnapshot.h"
 #include "detail/unregisteredfieldutils.h"
 #include "detail/utils.h"
+#include "detail/viewstreambuf.h"
 #include <figcone_tree/iparser.h>
 #include <figcone_tree/stringconverter.h>
 #include <figcone_tree/tree.h>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
+#include <sstream>
+#include <string_view>
 #include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 namespace figcone {
@@ -67,26 +99,211 @@ constexpr auto canBeReadAsParam()
 class ConfigReader {
 
 public:
-    explicit ConfigReader(NameFormat nameFormat = NameFormat::Original)
+    explicit ConfigReader(
+            NameFormat nameFormat = NameFormat::Original,
+            NodeListParallelism nodeListParallelism = NodeListParallelism{},
+            std::shared_ptr<TreeCache> treeCache = nullptr)
         : nameFormat_{nameFormat}
+        , nodeListParallelism_{nodeListParallelism}
+        , treeCache_{std::move(treeCache)}
+        , schemaPool_{std::make_unique<detail::ConfigSchemaPool>()}
     {
     }
 
+    //Sets the values overriding the config fields of every config read by this reader
+    void setOverlay(ConfigOverlay overlay)
+    {
+        overlay_ = std::move(overlay);
+    }
+
+    //Enables calling all validators of a config concurrently after it's loaded and post-processed, so the validators
+    //must be thread-safe. If several validators fail, the error of the first one in the registration order is reported.
+    //Must not be called while the reader is reading configs.
+    void setValidatorParallelism(ValidatorParallelism validatorParallelism)
+    {
+        validatorParallelism_ = validatorParallelism;
+    }
+
     template<typename TCfg, RootType rootType = RootType::SingleNode>
     auto readFile(const std::filesystem::path& configFile, IParser& parser)
             -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
     {
-        if (!std::filesystem::exists(configFile))
-            throw ConfigError{"Config file " + eel::to_string(configFile) + " doesn't exist"};
+        checkConfigFile(configFile);
+        if (treeCache_)
+            return read<TCfg, rootType>(*readFileTree(configFile, parser));
 
-        if (!std::filesystem::is_regular_file(configFile))
-            throw ConfigError{"Can't open config file " + eel::to_string(configFile) + " which is not a regular file"};
+        return read<TCfg, rootType>(parseFile(configFile, parser));
+    }
+
+    //Memory-maps the config file and passes its contents to parsers implementing IBufferParser without reading it
+    //into a stream buffer. Other parsers and compressed files are read through a stream, as with readFile.
+    //The file must not be truncated during reading, as accessing the mapped pages past its new end raises SIGBUS.
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readFileMapped(const std::filesystem::path& configFile, IParser& parser)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        checkConfigFile(configFile);
+        if (treeCache_)
+            return read<TCfg, rootType>(*readFileTree(configFile, parser, &ConfigReader::parseMappedFile));
 
-        auto configStream = std::ifstream{configFile, std::ios_base::binary};
-        if (!configStream.is_open())
+        return read<TCfg, rootType>(parseMappedFile(configFile, parser));
+    }
+
+    //Reads the config and saves it to snapshotFile, which is used instead of parsing and loading the config again on
+    //next reads, as long as the content of the config file, the parser's type, the config's type and its fields with
+    //their default values don't change. Configs restored from the snapshot are validated and post-processed again.
+    //When the config contains fields that can't be stored in the snapshot or the overlay is set, only the parsed tree
+    //is saved, and the config is loaded from it on next reads.
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readFile(
+            const std::filesystem::path& configFile,
+            IParser& parser,
+            const std::filesystem::path& snapshotFile)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        checkConfigFile(configFile);
+        auto configFileStream = std::ifstream{configFile, std::ios_base::binary};
+        if (!configFileStream.is_open())
             throw ConfigError{"Can't open config file " + eel::to_string(configFile) + " for reading"};
+        const auto configContent =
+                std::string{std::istreambuf_iterator<char>{configFileStream}, std::istreambuf_iterator<char>{}};
+        const auto content = std::string_view{configContent};
+        const auto snapshotKey = detail::makeSnapshotKey(content, typeid(parser).name());
 
-        return read<TCfg, rootType>(configStream, parser);
+        if (auto result = readSnapshotFile<TCfg, rootType>(snapshotFile, snapshotKey))
+            return std::move(*result);
+
+        auto tree = [&]
+        {
+            const auto isCompressed = detail::detectCompressionFormat(content) != detail::CompressionFormat::None;
+            auto bufferParser = dynamic_cast<IBufferParser*>(&parser);
+            if (bufferParser && !isCompressed)
+                return bufferParser->parse(content);
+            auto contentBuffer = detail::ViewStreamBuf{content};
+            auto configStream = detail::makeDecompressingStream(std::make_unique<std::istream>(&contentBuffer));
+            return parser.parse(*configStream);
+        }();
+        //the configs are stored before they're post-processed, as the post-processors run again after restoring them
+        auto configSnapshots = std::vector<std::optional<std::string>>(
+                tree.root().isList() ? static_cast<std::size_t>(tree.root().asList().size()) : 1);
+        auto result = read<TCfg, rootType>(
+                tree,
+                [&](std::size_t index, Schema<TCfg>& schema)
+                {
+                    if (overlay_.empty())
+                        configSnapshots[index] = writeConfigSnapshot(schema);
+                });
+        writeSnapshotFile<TCfg, rootType>(snapshotFile, configSnapshots, tree, snapshotKey);
+        return result;
+    }
+
+    //Reads config files on threadCount threads (0 - use std::thread::hardware_concurrency()) and returns the results in
+    //the order of configFiles. Each thread creates its own parser with parserFactory, which must return a pointer to
+    //IParser implementation. Errors that aren't ConfigError, including the ones thrown by parsers and parserFactory,
+    //are stored in the results as ConfigError too.
+    template<typename TCfg, typename TParserFactory>
+    std::vector<ReadFileResult<TCfg>> readFiles(
+            const std::vector<std::filesystem::path>& configFiles,
+            const TParserFactory& parserFactory,
+            int threadCount = 0)
+    {
+        const auto workerCount = detail::workerCount(threadCount, configFiles.size());
+        auto parsers = std::vector<std::unique_ptr<IParser>>(workerCount);
+        auto results = std::vector<std::optional<ReadFileResult<TCfg>>>(configFiles.size());
+        detail::parallelForDynamic(
+                configFiles.size(),
+                workerCount,
+                [&](std::size_t index, std::size_t workerIndex)
+                {
+                    const auto& configFile = configFiles[index];
+                    try {
+                        auto& parser = parsers[workerIndex];
+                        if (!parser)
+                            parser = parserFactory();
+                        results[index].emplace(readFile<TCfg>(configFile, *parser));
+                    }
+                    catch (const ConfigError& error) {
+                        results[index].emplace(error);
+                    }
+                    catch (const std::exception& error) {
+                        results[index].emplace(
+                                ConfigError{"Couldn't read config file " + eel::to_string(configFile) + ": " +
+                                            error.what()});
+                    }
+                    catch (...) {
+                        results[index].emplace(
+                                ConfigError{"Couldn't read config file " + eel::to_string(configFile) +
+                                            ": unknown error"});
+                    }
+                });
+
+        auto result = std::vector<ReadFileResult<TCfg>>{};
+        result.reserve(results.size());
+        for (auto& fileResult : results)
+            result.emplace_back(std::move(*fileResult));
+        return result;
+    }
+
+    //Reads the config file on the executor, the reading error is stored in the returned future.
+    //The reader must outlive the reading.
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readFileAsync(
+            std::filesystem::path configFile,
+            std::unique_ptr<IParser> parser,
+            const Executor& executor = {})
+            -> std::future<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>>
+    {
+        return detail::runAsync<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>>(
+                executor,
+                makeReadFileTask<TCfg, rootType>(std::move(configFile), std::move(parser)));
+    }
+
+#ifdef __cpp_impl_coroutine
+    //Returns an awaitable reading the config file on the executor, the awaiting coroutine is resumed on resumeExecutor,
+    //or on the reading thread if resumeExecutor is empty. The reading error is thrown from the co_await expression.
+    //The reader must outlive the reading.
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto readFileAwaitable(
+            std::filesystem::path configFile,
+            std::unique_ptr<IParser> parser,
+            Executor executor = {},
+            Executor resumeExecutor = {})
+            -> detail::AsyncTaskAwaitable<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>>
+    {
+        return {makeReadFileTask<TCfg, rootType>(std::move(configFile), std::move(parser)),
+                std::move(executor),
+                std::move(resumeExecutor)};
+    }
+#endif
+
+    //Merges the config files in the given order, so the fields of later files override the fields of earlier ones,
+    //and loads the config from the merged tree
+    template<typename TCfg>
+    TCfg readLayeredFiles(
+            const std::vector<std::filesystem::path>& configFiles,
+            IParser& parser,
+            ListMergeMode listMergeMode = ListMergeMode::Replace)
+    {
+        auto trees = std::vector<std::shared_ptr<const Tree>>{};
+        for (const auto& configFile : configFiles) {
+            checkConfigFile(configFile);
+            trees.emplace_back(readFileTree(configFile, parser));
+        }
+        return readLayers<TCfg>(trees, listMergeMode);
+    }
+
+    template<typename TCfg>
+    TCfg readLayered(
+            const std::vector<std::string>& configContents,
+            IParser& parser,
+            ListMergeMode listMergeMode = ListMergeMode::Replace)
+    {
+        auto trees = std::vector<std::shared_ptr<const Tree>>{};
+        for (const auto& configContent : configContents) {
+            auto configStream = std::stringstream{configContent};
+            trees.emplace_back(std::make_shared<const Tree>(parser.parse(configStream)));
+        }
+        return readLayers<TCfg>(trees, listMergeMode);
     }
 
     template<typename TCfg, RootType rootType = RootType::SingleNode>
@@ -97,6 +314,20 @@ public:
         return read<TCfg, rootType>(configStream, parser);
     }
 
+    //Returns a range reading configs from the stream one at a time. The reader, the stream and the parser must outlive
+    //the range.
+    template<typename TCfg>
+    ConfigRange<TCfg> readList(std::istream& configStream, IParser& parser, ConfigListFormat listFormat)
+    {
+        return ConfigRange<TCfg>{
+                configStream,
+                listFormat,
+                [this, &parser](std::istream& elementStream)
+                {
+                    return read<TCfg>(elementStream, parser);
+                }};
+    }
+
 #ifdef FIGCONE_JSON_AVAILABLE
     template<typename TCfg, RootType rootType = RootType::SingleNode>
     auto readJsonFile(const std::filesystem::path& configFile)
@@ -122,6 +353,18 @@ public:
         return read<TCfg, rootType>(configStream, parser);
     }
 
+    template<typename TCfg>
+    ConfigRange<TCfg> readJsonList(std::istream& configStream)
+    {
+        return makeConfigRange<TCfg>(configStream, std::make_unique<figcone::json::Parser>(), ConfigListFormat::Json);
+    }
+
+    template<typename TCfg>
+    ConfigRange<TCfg> readJsonListFile(const std::filesystem::path& configFile)
+    {
+        return readListFile<TCfg>(configFile, std::make_unique<figcone::json::Parser>(), ConfigListFormat::Json);
+    }
+
 #endif
 
 #ifdef FIGCONE_YAML_AVAILABLE
@@ -148,6 +391,18 @@ public:
         auto parser = figcone::yaml::Parser{};
         return read<TCfg, rootType>(configStream, parser);
     }
+
+    template<typename TCfg>
+    ConfigRange<TCfg> readYamlList(std::istream& configStream)
+    {
+        return makeConfigRange<TCfg>(configStream, std::make_unique<figcone::yaml::Parser>(), ConfigListFormat::Yaml);
+    }
+
+    template<typename TCfg>
+    ConfigRange<TCfg> readYamlListFile(const std::filesystem::path& configFile)
+    {
+        return readListFile<TCfg>(configFile, std::make_unique<figcone::yaml::Parser>(), ConfigListFormat::Yaml);
+    }
 #endif
 
 #ifdef FIGCONE_TOML_AVAILABLE
@@ -235,14 +490,261 @@ public:
 #endif
 
 private:
-    void addNode(const std::string& name, std::unique_ptr<detail::INode> node)
+    template<typename TCfg>
+    class Schema;
+
+    struct IgnoreBoundConfig {
+        template<typename... TArgs>
+        void operator()(TArgs&&...) const
+        {
+        }
+    };
+
+    static void checkConfigFile(const std::filesystem::path& configFile)
+    {
+        if (!std::filesystem::exists(configFile))
+            throw ConfigError{"Config file " + eel::to_string(configFile) + " doesn't exist"};
+
+        if (!std::filesystem::is_regular_file(configFile))
+            throw ConfigError{"Can't open config file " + eel::to_string(configFile) + " which is not a regular file"};
+    }
+
+    static std::unique_ptr<std::istream> openConfigFile(const std::filesystem::path& configFile)
     {
-        nodes_.emplace(detail::convertName(nameFormat_, name), std::move(node));
+        auto configStream = std::make_unique<std::ifstream>(configFile, std::ios_base::binary);
+        if (!configStream->is_open())
+            throw ConfigError{"Can't open config file " + eel::to_string(configFile) + " for reading"};
+        return detail::makeDecompressingStream(std::move(configStream));
+    }
+
+    std::shared_ptr<const Tree> readFileTree(
+            const std::filesystem::path& configFile,
+            IParser& parser,
+            Tree (*parseFunc)(const std::filesystem::path&, IParser&) = &ConfigReader::parseFile)
+    {
+        if (!treeCache_)
+            return std::make_shared<const Tree>(parseFunc(configFile, parser));
+
+        return treeCache_->tree(
+                configFile,
+                typeid(parser).name(),
+                [&]
+                {
+                    return parseFunc(configFile, parser);
+                });
+    }
+
+    template<typename TCfg>
+    TCfg readLayers(const std::vector<std::shared_ptr<const Tree>>& trees, ListMergeMode listMergeMode)
+    {
+        auto layers = std::vector<const Tree*>{};
+        for (const auto& tree : trees)
+            layers.push_back(tree.get());
+        return read<TCfg>(detail::TreeMerger{listMergeMode}.merge(layers));
+    }
+
+    static Tree parseFile(const std::filesystem::path& configFile, IParser& parser)
+    {
+        return parser.parse(*openConfigFile(configFile));
+    }
+
+    static Tree parseMappedFile(const std::filesystem::path& configFile, IParser& parser)
+    {
+        if (auto bufferParser = dynamic_cast<IBufferParser*>(&parser)) {
+            auto mappedFile = detail::MappedFile{configFile};
+            if (mappedFile.isMapped() &&
+                detail::detectCompressionFormat(mappedFile.data()) == detail::CompressionFormat::None)
+                return bufferParser->parse(mappedFile.data());
+        }
+        return parser.parse(*openConfigFile(configFile));
     }
 
-    void addParam(const std::string& name, std::unique_ptr<detail::IParam> param)
+    template<typename TCfg, RootType rootType>
+    auto readSnapshotFile(const std::filesystem::path& snapshotFile, const detail::SnapshotKey& snapshotKey)
+            -> std::optional<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>>
     {
-        params_.emplace(detail::convertName(nameFormat_, name), std::move(param));
+        using Result = std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>;
+        return detail::readSnapshotFile(
+                snapshotFile,
+                [&](std::string_view snapshot) -> std::optional<Result>
+                {
+                    if (overlay_.empty())
+                        if (auto result = readConfigSnapshot<TCfg, rootType>(snapshot, snapshotKey))
+                            return result;
+                    if (auto tree = detail::TreeSnapshotReader::read(snapshot, snapshotKey))
+                        return read<TCfg, rootType>(*tree);
+                    return std::nullopt;
+                });
+    }
+
+    template<typename TCfg, RootType rootType>
+    void writeSnapshotFile(
+            const std::filesystem::path& snapshotFile,
+            const std::vector<std::optional<std::string>>& configSnapshots,
+            const Tree& tree,
+            const detail::SnapshotKey& snapshotKey)
+    {
+        if (overlay_.empty())
+            if (auto snapshot = writeConfigListSnapshot<TCfg, rootType>(configSnapshots, snapshotKey)) {
+                detail::writeSnapshotFile(snapshotFile, *snapshot);
+                return;
+            }
+        if (auto snapshot = detail::TreeSnapshotWriter::write(tree, snapshotKey))
+            detail::writeSnapshotFile(snapshotFile, *snapshot);
+    }
+
+    //Config snapshots are made for the config type, the name format and the schema of the config, i.e. the names,
+    //types and default values of its fields and the number of its validators, so they're ignored after any of them
+    //changes. Returns std::nullopt if the schema can't be stored in the snapshot.
+    template<typename TCfg, RootType rootType>
+    std::optional<std::string> configSnapshotType()
+    {
+        auto schema = acquireSchema<TCfg>();
+        schema->cfg() = TCfg{};
+        auto writer = detail::ConfigSnapshotWriter{};
+        if (!schema->reader().writeSchema(writer))
+            return std::nullopt;
+
+        using Result = std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>;
+        return std::string{typeid(Result).name()} + "/" + std::to_string(static_cast<int>(nameFormat_)) + "/" +
+                std::to_string(detail::snapshotHash(std::move(writer).finish()));
+    }
+
+    //returns std::nullopt if the config contains fields that can't be stored in the snapshot
+    template<typename TCfg>
+    std::optional<std::string> writeConfigSnapshot(Schema<TCfg>& schema)
+    {
+        auto writer = detail::ConfigSnapshotWriter{};
+        if (!schema.reader().writeSnapshot(writer))
+            return std::nullopt;
+        return std::move(writer).finish();
+    }
+
+    template<typename TCfg, RootType rootType>
+    std::optional<std::string> writeConfigListSnapshot(
+            const std::vector<std::optional<std::string>>& configSnapshots,
+            const detail::SnapshotKey& snapshotKey)
+    {
+        for (const auto& configSnapshot : configSnapshots)
+            if (!configSnapshot)
+                return std::nullopt;
+        const auto configType = configSnapshotType<TCfg, rootType>();
+        if (!configType)
+            return std::nullopt;
+
+        auto writer = detail::SnapshotDataWriter{};
+        writer.writeHeader(detail::config_snapshot::magic, snapshotKey);
+        writer.writeString(*configType);
+        writer.writeInt(configSnapshots.size());
+        for (const auto& configSnapshot : configSnapshots)
+            writer.writeString(*configSnapshot);
+        return std::move(writer).finish();
+    }
+
+    //Returns std::nullopt if the snapshot is damaged or was made for another config. The restored configs are
+    //validated and post-processed, on errors the config file is read again to report them with their positions.
+    template<typename TCfg, RootType rootType>
+    auto readConfigSnapshot(std::string_view snapshot, const detail::SnapshotKey& snapshotKey)
+            -> std::optional<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>>
+    {
+        auto data = detail::SnapshotDataReader::open(snapshot, detail::config_snapshot::magic, snapshotKey);
+        if (!data)
+            return std::nullopt;
+
+        try {
+            const auto configType = configSnapshotType<TCfg, rootType>();
+            if (!configType || data->readString() != *configType)
+                return std::nullopt;
+
+            const auto size = data->readCount();
+            if (rootType == RootType::SingleNode && size != 1)
+                return std::nullopt;
+            auto schema = acquireSchema<TCfg>();
+            auto result = std::vector<TCfg>{};
+            result.reserve(size);
+            for (auto i = std::size_t{}; i < size; ++i) {
+                auto reader = detail::ConfigSnapshotReader::open(data->readBytes(data->readCount()));
+                if (!reader)
+                    return std::nullopt;
+                result.emplace_back(bindConfig<TCfg>(
+                        *schema,
+                        [&](ConfigReader& cfgReader)
+                        {
+                            cfgReader.readSnapshot(*reader);
+                            if (!reader->isFinished())
+                                throw detail::ConfigSnapshotReader::ReadError{};
+                        }));
+            }
+            if (!data->isFinished())
+                return std::nullopt;
+
+            if constexpr (rootType == RootType::SingleNode)
+                return std::move(result.front());
+            else
+                return result;
+        }
+        catch (const detail::ConfigSnapshotReader::ReadError&) {
+            return std::nullopt;
+        }
+        catch (const ConfigError&) {
+            return std::nullopt;
+        }
+    }
+
+    template<typename TCfg>
+    ConfigRange<TCfg> makeConfigRange(
+            std::istream& configStream,
+            std::shared_ptr<IParser> parser,
+            ConfigListFormat listFormat,
+            std::unique_ptr<std::istream> ownedConfigStream = nullptr)
+    {
+        return ConfigRange<TCfg>{
+                configStream,
+                listFormat,
+                [this, parser](std::istream& elementStream)
+                {
+                    return read<TCfg>(elementStream, *parser);
+                },
+                std::move(ownedConfigStream)};
+    }
+
+    template<typename TCfg, RootType rootType>
+    auto makeReadFileTask(std::filesystem::path configFile, std::unique_ptr<IParser> parser)
+            -> std::function<std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>()>
+    {
+        //std::function requires a copyable callable
+        return [this, configFile = std::move(configFile), parser = std::shared_ptr<IParser>{std::move(parser)}]
+        {
+            return readFile<TCfg, rootType>(configFile, *parser);
+        };
+    }
+
+    template<typename TCfg>
+    ConfigRange<TCfg> readListFile(
+            const std::filesystem::path& configFile,
+            std::shared_ptr<IParser> parser,
+            ConfigListFormat listFormat)
+    {
+        checkConfigFile(configFile);
+        auto configStream = openConfigFile(configFile);
+        auto& configStreamRef = *configStream;
+        return makeConfigRange<TCfg>(configStreamRef, std::move(parser), listFormat, std::move(configStream));
+    }
+
+    void addNode(const detail::FieldName& name, std::unique_ptr<detail::INode> node, const void* field)
+    {
+        const auto it = nodes_.emplace(name.convertedName(nameFormat_), std::move(node)).first;
+        fieldNames_.emplace(field, it->first);
+        nodeIndex_.reset();
+        overlayIndex_.reset();
+    }
+
+    void addParam(const detail::FieldName& name, std::unique_ptr<detail::IParam> param, const void* field)
+    {
+        const auto it = params_.emplace(name.convertedName(nameFormat_), std::move(param)).first;
+        fieldNames_.emplace(field, it->first);
+        paramIndex_.reset();
+        overlayIndex_.reset();
     }
 
     void addValidator(std::unique_ptr<detail::IValidator> validator)
@@ -253,31 +755,174 @@ private:
     template<typename TConfig>
     void load(const TreeNode& treeNode)
     {
-        for (const auto& nodeName : treeNode.asItem().nodeNames()) {
-            const auto& node = treeNode.asItem().node(nodeName);
-            if (!nodes_.count(nodeName)) {
-                detail::handleUnregisteredField<TConfig>(FieldType::Node, nodeName, node.position());
+        updateFieldIndex();
+        for (const auto& nodeName : treeNode.asItem().nodeNames())
+            loadNode<TConfig>(nodeName, treeNode.asItem().node(nodeName));
+        for (const auto& paramName : treeNode.asItem().paramNames())
+            loadParam<TConfig>(paramName, treeNode.asItem().param(paramName));
+        if (overlayNode_)
+            loadOverlay<TConfig>(treeNode);
+
+        checkLoadingResult();
+    }
+
+    //Loads the fields that differ from the previous node and runs the validators of the node again. Returns false if
+    //some fields can't be loaded this way, then the node must be loaded completely.
+    //Fields removed from the previous node aren't handled, as they require loading the default values.
+    bool loadChanges(const TreeNode& previousNode, const TreeNode& node)
+    {
+        updateFieldIndex();
+        const auto& previousItem = previousNode.asItem();
+        const auto& item = node.asItem();
+        for (const auto& paramName : item.paramNames()) {
+            const auto& param = item.param(paramName);
+            if (previousItem.hasParam(paramName) && detail::isEqual(previousItem.param(paramName), param))
                 continue;
-            }
 
+            auto registeredParam = paramIndex_->find(paramName);
+            if (!registeredParam)
+                return false;
+            registeredParam->load(param);
+        }
+
+        for (const auto& nodeName : item.nodeNames()) {
+            const auto& childNode = item.node(nodeName);
+            const auto hasPreviousNode = previousItem.hasNode(nodeName);
+            if (hasPreviousNode && detail::isEqual(previousItem.node(nodeName), childNode))
+                continue;
+
+            auto registeredNode = nodeIndex_->find(nodeName);
+            if (!registeredNode)
+                return false;
             try {
-                nodes_.at(nodeName)->load(node);
+                if (!hasPreviousNode || !registeredNode->loadChanges(previousItem.node(nodeName), childNode))
+                    registeredNode->load(childNode);
             }
             catch (const detail::LoadingError& e) {
-                throw ConfigError{"Node '" + nodeName + "': " + e.what(), node.position()};
+                throw ConfigError{"Node '" + nodeName + "': " + e.what(), childNode.position()};
             }
         }
 
-        for (const auto& paramName : treeNode.asItem().paramNames()) {
-            const auto& param = treeNode.asItem().param(paramName);
-            if (!params_.count(paramName)) {
-                detail::handleUnregisteredField<TConfig>(FieldType::Param, paramName, param.position());
-                continue;
+        validate();
+        return true;
+    }
+
+    void updateFieldIndex()
+    {
+        if (!nodeIndex_)
+            nodeIndex_.emplace(nodes_);
+        if (!paramIndex_)
+            paramIndex_.emplace(params_);
+    }
+
+    template<typename TConfig>
+    void loadNode(const std::string& nodeName, const TreeNode& node)
+    {
+        auto registeredNode = nodeIndex_->find(nodeName);
+        if (!registeredNode) {
+            detail::handleUnregisteredField<TConfig>(FieldType::Node, nodeName, node.position());
+            return;
+        }
+
+        auto overlayScope = std::optional<OverlayScope>{};
+        if (overlayNode_)
+            if (auto nestedOverlayNode = findNestedOverlayNode(nodeName))
+                overlayScope.emplace(nestedOverlayReader(nodeName, *nestedOverlayNode), nestedOverlayNode);
+
+        try {
+            registeredNode->load(node);
+        }
+        catch (const detail::LoadingError& e) {
+            throw ConfigError{"Node '" + nodeName + "': " + e.what(), node.position()};
+        }
+    }
+
+    template<typename TConfig>
+    void loadParam(const std::string& paramName, const TreeParam& param)
+    {
+        auto registeredParam = paramIndex_->find(paramName);
+        if (!registeredParam) {
+            detail::handleUnregisteredField<TConfig>(FieldType::Param, paramName, param.position());
+            return;
+        }
+        registeredParam->load(param);
+    }
+
+    //Overrides the loaded fields with the values of the overlay node. Nested overlay nodes are applied by the nested
+    //readers when their nodes are loaded, the nodes missing in the config are loaded from empty trees.
+    template<typename TConfig>
+    void loadOverlay(const TreeNode& treeNode)
+    {
+        for (const auto& overlayParam : overlayNode_->params) {
+            const auto paramName = findOverlayField(overlayParam.name);
+            auto registeredParam = paramName.empty() ? nullptr : paramIndex_->find(paramName);
+            if (!registeredParam) {
+                if (overlayParam.matching == OverlayFieldMatching::IgnoreUnmatched)
+                    continue;
+                throw ConfigError{overlayParam.source + " doesn't match any config parameter"};
+            }
+
+            try {
+                registeredParam->load(detail::makeOverlayTreeParam(overlayParam.value, registeredParam->isList()));
+            }
+            catch (const ConfigError& e) {
+                throw ConfigError{overlayParam.source + ": " + e.what()};
             }
-            params_.at(paramName)->load(param);
         }
 
-        checkLoadingResult();
+        for (const auto& nestedOverlayNode : overlayNode_->nodes) {
+            const auto nodeName = std::string{findOverlayField(nestedOverlayNode.name)};
+            if (nodeName.empty() || !nodeIndex_->find(nodeName)) {
+                if (nestedOverlayNode.matching == OverlayFieldMatching::IgnoreUnmatched)
+                    continue;
+                throw ConfigError{nestedOverlayNode.source + " doesn't match any config node"};
+            }
+            if (!treeNode.asItem().hasNode(nodeName))
+                loadNode<TConfig>(nodeName, *makeTreeRoot());
+        }
+    }
+
+    const detail::OverlayNode* findNestedOverlayNode(std::string_view nodeName)
+    {
+        for (const auto& nestedOverlayNode : overlayNode_->nodes)
+            if (findOverlayField(nestedOverlayNode.name) == nodeName)
+                return &nestedOverlayNode;
+        return nullptr;
+    }
+
+    ConfigReader& nestedOverlayReader(const std::string& nodeName, const detail::OverlayNode& nestedOverlayNode)
+    {
+        auto nestedReader = nestedReaders_.find(nodeName);
+        if (nestedReader == nestedReaders_.end())
+            throw ConfigError{nestedOverlayNode.source + ": fields of node '" + nodeName + "' can't be overridden"};
+        return *nestedReader->second;
+    }
+
+    //Returns the registered name of the field matching the overlay field name or an empty string if it's not found
+    std::string_view findOverlayField(const std::string& overlayFieldName)
+    {
+        if (paramIndex_->find(overlayFieldName) || nodeIndex_->find(overlayFieldName))
+            return overlayFieldName;
+
+        if (!overlayIndex_) {
+            overlayIndex_.emplace();
+            for (const auto& [name, param] : params_)
+                overlayIndex_->emplace(detail::overlayFieldKey(name), name);
+            for (const auto& [name, node] : nodes_)
+                overlayIndex_->emplace(detail::overlayFieldKey(name), name);
+        }
+        auto field = overlayIndex_->find(detail::overlayFieldKey(overlayFieldName));
+        if (field == overlayIndex_->end())
+            return {};
+        return field->second;
+    }
+
+    void reset()
+    {
+        for (auto& [name, param] : params_)
+            param->reset();
+        for (auto& [name, node] : nodes_)
+            node->reset();
     }
 
     void checkLoadingResult()
@@ -289,28 +934,107 @@ private:
             if (!node->hasValue())
                 throw detail::LoadingError{"Node '" + name + "' is missing."};
 
+        validate();
+    }
+
+    bool writeSnapshot(detail::ConfigSnapshotWriter& writer)
+    {
+        for (auto& [name, param] : params_)
+            if (!param->writeSnapshot(writer))
+                return false;
+        for (auto& [name, node] : nodes_)
+            if (!node->writeSnapshot(writer))
+                return false;
+        return true;
+    }
+
+    void readSnapshot(detail::ConfigSnapshotReader& reader)
+    {
+        for (auto& [name, param] : params_)
+            param->readSnapshot(reader);
+        for (auto& [name, node] : nodes_)
+            node->readSnapshot(reader);
+        validate();
+    }
+
+    //Called for a default constructed config, the params without default values are stored without values, as they
+    //aren't initialized
+    bool writeSchema(detail::ConfigSnapshotWriter& writer)
+    {
+        for (auto& [name, param] : params_) {
+            param->reset();
+            if (!param->hasValue())
+                writer.writeField(name, typeid(void));
+            else if (!param->writeSnapshot(writer))
+                return false;
+        }
+        for (auto& [name, node] : nodes_)
+            if (!node->writeSchema(writer))
+                return false;
+        writer.writeCount(validators_.size());
+        return true;
+    }
+
+    void validate()
+    {
+        if (validatorList_) {
+            for (const auto& validator : validators_)
+                validatorList_->push_back(validator.get());
+            return;
+        }
+
         for (const auto& validator : validators_)
             validator->validate();
     }
 
-    detail::ConfigReaderPtr makeNestedReader(const std::string& name)
+    void setValidatorList(std::vector<detail::IValidator*>* validatorList)
+    {
+        validatorList_ = validatorList;
+        for (auto& [name, nestedReader] : nestedReaders_)
+            nestedReader->setValidatorList(validatorList);
+    }
+
+    detail::ConfigReaderPtr makeNestedReader(std::string_view name)
     {
-        nestedReaders_.emplace(name, std::make_unique<ConfigReader>(nameFormat_));
-        return nestedReaders_[name]->makePtr();
+        auto& nestedReader = nestedReaders_[detail::convertName(nameFormat_, name)];
+        nestedReader = std::make_unique<ConfigReader>(nameFormat_, nodeListParallelism_);
+        return nestedReader->makePtr();
+    }
+
+    //The elements of node lists are loaded by the readers of pooled schemas, the reader of a node list only provides
+    //them, so it's stored apart from the readers of nested nodes
+    detail::ConfigReaderPtr makeNodeListReader(std::string_view name)
+    {
+        auto& nodeListReader = nodeListReaders_[detail::convertName(nameFormat_, name)];
+        nodeListReader = std::make_unique<ConfigReader>(nameFormat_, nodeListParallelism_);
+        return nodeListReader->makePtr();
     }
 
     template<typename TCfg, RootType rootType = RootType::SingleNode>
     auto read(std::istream& configStream, IParser& parser)
             -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
     {
-        auto tree = parser.parse(configStream);
+        return read<TCfg, rootType>(parser.parse(configStream));
+    }
+
+    //Calls onBound(index, schema) for every config of the document after it's loaded, before it's post-processed
+    template<typename TCfg, RootType rootType = RootType::SingleNode, typename TOnBound = IgnoreBoundConfig>
+    auto read(const Tree& tree, const TOnBound& onBound = {})
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
         auto result = std::vector<TCfg>{};
-        if (tree.root().isList()) {
-            for (auto i = 0; i < tree.root().asList().size(); ++i)
-                result.emplace_back(readConfig<TCfg>(tree.root().asList().at(i)));
+        if (tree.root().isList())
+            result = readConfigList<TCfg>(tree.root(), onBound);
+        else {
+            auto schema = acquireSchema<TCfg>();
+            result.emplace_back(readConfig<TCfg>(
+                    *schema,
+                    tree.root(),
+                    [&](Schema<TCfg>& boundSchema)
+                    {
+                        onBound(std::size_t{}, boundSchema);
+                    }));
         }
-        else
-            result.emplace_back(readConfig<TCfg>(tree.root()));
 
         if constexpr (rootType == RootType::SingleNode) {
             if (result.size() != 1)
@@ -322,12 +1046,9 @@ private:
             return result;
     }
 
-    void clear()
+    const NodeListParallelism& nodeListParallelism() const
     {
-        nodes_.clear();
-        params_.clear();
-        nestedReaders_.clear();
-        validators_.clear();
+        return nodeListParallelism_;
     }
 
     detail::ConfigReaderPtr makePtr()
@@ -342,12 +1063,12 @@ private:
     }
 
     template<typename TCfg, typename TField>
-    void loadField(TCfg& cfg, TField& field, std::string_view name)
+    void loadField(TCfg& cfg, TField& field, const detail::FieldName& name)
     {
         const auto isOptionalField = detail::isOptionalField(cfg, field);
         const auto isCopyNodeListField = detail::isCopyNodeListField(cfg, field);
         if constexpr (detail::canBeReadAsParam<TField>()) {
-            auto paramCreator = detail::ParamCreator{makePtr(), std::string{name}, field, isOptionalField};
+            auto paramCreator = detail::ParamCreator{makePtr(), name, field, isOptionalField};
             detail::setFieldValidators(cfg, field, paramCreator);
             paramCreator.createParam();
         }
@@ -355,20 +1076,20 @@ private:
             static_assert(
                     detail::canBeReadAsParam<typename eel::remove_optional_t<TField>::mapped_type>(),
                     "Dict value type must be readable from stringtream or registered with StringConverter");
-            auto dictCreator = detail::DictCreator{makePtr(), std::string{name}, field, isOptionalField};
+            auto dictCreator = detail::DictCreator{makePtr(), name, field, isOptionalField};
             detail::setFieldValidators(cfg, field, dictCreator);
             dictCreator.createDict();
         }
         else if constexpr (eel::is_dynamic_sequence_container_v<eel::remove_optional_t<TField>>) {
             if constexpr (detail::canBeReadAsParam<typename eel::remove_optional_t<TField>::value_type>()) {
-                auto paramListCreator = detail::ParamListCreator{makePtr(), std::string{name}, field, isOptionalField};
+                auto paramListCreator = detail::ParamListCreator{makePtr(), name, field, isOptionalField};
                 detail::setFieldValidators(cfg, field, paramListCreator);
                 paramListCreator.createParamList();
             }
             else {
                 auto nodeListCreator = detail::NodeListCreator<TField, detail::CreatorMode::StaticReflection>{
                         makePtr(),
-                        std::string{name},
+                        name,
                         field,
                         isCopyNodeListField ? detail::NodeListType::Copy : detail::NodeListType::Normal,
                         isOptionalField};
@@ -379,7 +1100,7 @@ private:
         else {
             auto nodeCreator = detail::NodeCreator<TField, detail::CreatorMode::StaticReflection>{
                     makePtr(),
-                    std::string{name},
+                    name,
                     field,
                     isOptionalField};
             detail::setFieldValidators(cfg, field, nodeCreator);
@@ -390,7 +1111,19 @@ private:
     template<typename TCfg, std::size_t... indices>
     void loadStructure(TCfg& cfg, std::index_sequence<indices...>)
     {
-        (loadField(cfg, pfr::get<indices>(cfg), pfr::get_name<indices, TCfg>()), ...);
+        (loadField(
+                 cfg,
+                 pfr::get<indices>(cfg),
+                 detail::FieldName{pfr::get_name<indices, TCfg>(), &convertedFieldName<TCfg, indices>}),
+         ...);
+    }
+
+    template<typename TCfg, std::size_t index>
+    static std::string_view convertedFieldName(NameFormat nameFormat)
+    {
+        static constexpr auto names =
+                detail::ConvertedNames<pfr::get_name<index, TCfg>().size()>{pfr::get_name<index, TCfg>()};
+        return names.get(nameFormat);
     }
 
     template<typename TCfg>
@@ -406,32 +1139,14 @@ private:
     }
 
     template<typename TCfg>
-    TCfg readConfig(const figcone::TreeNode& root)
+    auto acquireSchema()
     {
-        clear();
-
         if constexpr (!std::is_base_of_v<figcone::Config, TCfg>) {
             if constexpr (!std::is_aggregate_v<TCfg>)
                 static_assert(
                         std::is_constructible_v<TCfg, detail::ConfigReaderPtr>,
                         "Static reflection interface isn't compatible with non-aggregate types. Inherit from "
                         "figcone::Config to use runtime reflection interface");
-
-            auto cfg = TCfg{};
-            loadStructure(cfg);
-            try {
-                load<TCfg>(root);
-            }
-            catch (const detail::LoadingError& e) {
-                throw ConfigError{std::string{"Root node: "} + e.what(), root.position()};
-            }
-            try {
-                PostProcessor<TCfg>{}(cfg);
-            }
-            catch (const ValidationError& e) {
-                throw ConfigError{std::string{"Config is invalid: "} + e.what()};
-            }
-            return cfg;
         }
         else {
             if constexpr (!std::is_aggregate_v<TCfg>)
@@ -439,35 +1154,308 @@ private:
                         std::is_constructible_v<TCfg, detail::ConfigReaderPtr>,
                         "Non aggregate config objects must inherit figcone::Config constructors with 'using "
                         "Config::Config;'");
+        }
+        //the cached config object of the schema is reset by assigning a default constructed config before each read
+        static_assert(
+                std::is_default_constructible_v<TCfg> && std::is_move_assignable_v<TCfg>,
+                "Config types must be default constructible and move assignable, so config fields can't be const "
+                "or references");
 
-            auto cfg = TCfg{makePtr()};
+        return schemaPool_->acquire<Schema<TCfg>>(
+                [this]
+                {
+                    return std::make_unique<Schema<TCfg>>(nameFormat_, nodeListParallelism_);
+                });
+    }
+
+    //Sets the overlay node applied by the reader while loading, until the end of the scope
+    class OverlayScope {
+    public:
+        OverlayScope(ConfigReader& reader, const detail::OverlayNode* overlayNode)
+            : reader_{reader}
+        {
+            reader_.overlayNode_ = overlayNode;
+        }
+
+        ~OverlayScope()
+        {
+            reader_.overlayNode_ = nullptr;
+        }
+
+        OverlayScope(const OverlayScope&) = delete;
+        OverlayScope& operator=(const OverlayScope&) = delete;
+
+    private:
+        ConfigReader& reader_;
+    };
+
+    //Collects the validators of the reader and its nested readers into the list instead of calling them, until the end
+    //of the scope. Node list elements are moved out of their schemas while loading, so they're validated immediately.
+    class ValidatorListScope {
+    public:
+        ValidatorListScope(
+                ConfigReader& reader,
+                std::vector<detail::IValidator*>& validatorList,
+                const ValidatorParallelism& validatorParallelism)
+            : reader_{reader}
+        {
+            if (validatorParallelism.threadCount != 1)
+                reader_.setValidatorList(&validatorList);
+        }
+
+        ~ValidatorListScope()
+        {
+            reader_.setValidatorList(nullptr);
+        }
+
+        ValidatorListScope(const ValidatorListScope&) = delete;
+        ValidatorListScope& operator=(const ValidatorListScope&) = delete;
+
+    private:
+        ConfigReader& reader_;
+    };
+
+    template<typename TCfg, typename TOnBound>
+    std::vector<TCfg> readConfigList(const figcone::TreeNode& rootList, const TOnBound& onBound)
+    {
+        const auto size = static_cast<std::size_t>(rootList.asList().size());
+        const auto workerCount = detail::workerCount(nodeListParallelism_, size);
+        auto schemas = std::vector<decltype(acquireSchema<TCfg>())>{};
+        schemas.reserve(workerCount);
+        for (auto i = std::size_t{}; i < workerCount; ++i)
+            schemas.emplace_back(acquireSchema<TCfg>());
+
+        auto result = std::vector<TCfg>(size);
+        detail::parallelFor(
+                size,
+                workerCount,
+                [&](std::size_t index, std::size_t workerIndex)
+                {
+                    const auto& element = rootList.asList().at(static_cast<int>(index));
+                    result[index] = readConfig<TCfg>(
+                            *schemas[workerIndex],
+                            element,
+                            [&](Schema<TCfg>& schema)
+                            {
+                                onBound(index, schema);
+                            });
+                });
+        return result;
+    }
+
+    template<typename TCfg, typename TOnBound = IgnoreBoundConfig>
+    TCfg readConfig(Schema<TCfg>& schema, const figcone::TreeNode& root, const TOnBound& onBound = {})
+    {
+        return bindConfig<TCfg>(
+                schema,
+                [&](ConfigReader& reader)
+                {
+                    auto overlayScope = OverlayScope{reader, overlay_.empty() ? nullptr : &overlay_.root()};
+                    try {
+                        reader.load<TCfg>(root);
+                    }
+                    catch (const detail::LoadingError& e) {
+                        throw ConfigError{std::string{"Root node: "} + e.what(), root.position()};
+                    }
+                },
+                onBound);
+    }
+
+    //Reads the config and stores it to boundCfg before it's post-processed, so that readChanges can load the changed
+    //fields into it without post-processing the config twice
+    template<typename TCfg>
+    TCfg readBound(const Tree& tree, TCfg& boundCfg)
+    {
+        auto newBoundCfg = std::optional<TCfg>{};
+        auto result = read<TCfg>(tree, makeBoundConfigStorage(newBoundCfg));
+        boundCfg = std::move(*newBoundCfg);
+        return result;
+    }
+
+    //boundCfg is the previous config stored by readBound or readChanges, it's replaced after the new config is read
+    template<typename TCfg>
+    std::optional<TCfg> readChanges(
+            TCfg& boundCfg,
+            const Tree& previousTree,
+            const Tree& tree,
+            std::vector<std::string>& changedFields)
+    {
+        changedFields.clear();
+        auto newBoundCfg = std::optional<TCfg>{};
+        auto result = readChangedFields(boundCfg, newBoundCfg, previousTree, tree, changedFields);
+        if (newBoundCfg)
+            boundCfg = std::move(*newBoundCfg);
+        return result;
+    }
+
+    template<typename TCfg>
+    std::optional<TCfg> readChangedFields(
+            const TCfg& boundCfg,
+            std::optional<TCfg>& newBoundCfg,
+            const Tree& previousTree,
+            const Tree& tree,
+            std::vector<std::string>& changedFields)
+    {
+        const auto storeBoundCfg = makeBoundConfigStorage(newBoundCfg);
+        if (previousTree.root().isList() || tree.root().isList())
+            return read<TCfg>(tree, storeBoundCfg);
+
+        auto treeDiff = detail::TreeDiff{previousTree.root(), tree.root()};
+        changedFields = std::move(treeDiff.changedFields());
+        if (changedFields.empty())
+            return std::nullopt;
+        //the overlay is applied when all fields are loaded
+        if (treeDiff.hasRemovedFields() || !overlay_.empty())
+            return read<TCfg>(tree, storeBoundCfg);
+
+        auto schema = acquireSchema<TCfg>();
+        schema->cfg() = TCfg{boundCfg};
+        auto validators = std::vector<detail::IValidator*>{};
+        auto isLoaded = false;
+        {
+            auto validatorListScope = ValidatorListScope{schema->reader(), validators, validatorParallelism_};
             try {
-                load<TCfg>(root);
+                isLoaded = schema->reader().loadChanges(previousTree.root(), tree.root());
             }
             catch (const detail::LoadingError& e) {
-                throw ConfigError{std::string{"Root node: "} + e.what(), root.position()};
+                throw ConfigError{std::string{"Root node: "} + e.what(), tree.root().position()};
             }
-            try {
-                PostProcessor<TCfg>{}(cfg);
-            }
-            catch (const ValidationError& e) {
-                throw ConfigError{std::string{"Config is invalid: "} + e.what()};
-            }
-            resetConfigReader(cfg);
-            return cfg;
         }
+        if (!isLoaded)
+            return readConfig<TCfg>(
+                    *schema,
+                    tree.root(),
+                    [&](Schema<TCfg>& boundSchema)
+                    {
+                        storeBoundCfg(std::size_t{}, boundSchema);
+                    });
+        storeBoundCfg(std::size_t{}, *schema);
+        return postProcessConfig(*schema, validators);
+    }
+
+    template<typename TCfg>
+    auto makeBoundConfigStorage(std::optional<TCfg>& boundCfg)
+    {
+        return [this, &boundCfg](std::size_t, Schema<TCfg>& schema)
+        {
+            boundCfg.emplace(schema.cfg());
+            resetConfigReader(*boundCfg);
+        };
+    }
+
+    //Returns the name of the config field, as it's used in the config files
+    template<typename TCfg, typename TField>
+    std::string fieldName(TField TCfg::*member)
+    {
+        auto schema = acquireSchema<TCfg>();
+        const auto it = schema->reader().fieldNames_.find(&(schema->cfg().*member));
+        if (it == schema->reader().fieldNames_.end())
+            throw ConfigError{"Member isn't registered as a config field"};
+        return it->second;
+    }
+
+    template<typename TCfg, typename TLoadFunc, typename TOnBound = IgnoreBoundConfig>
+    TCfg bindConfig(Schema<TCfg>& schema, const TLoadFunc& loadFunc, const TOnBound& onBound = {})
+    {
+        auto& cfg = schema.cfg();
+        cfg = TCfg{};
+        schema.reader().reset();
+        auto validators = std::vector<detail::IValidator*>{};
+        {
+            auto validatorListScope = ValidatorListScope{schema.reader(), validators, validatorParallelism_};
+            loadFunc(schema.reader());
+        }
+        onBound(schema);
+        return postProcessConfig(schema, validators);
+    }
+
+    //The collected validators refer to the fields of the schema config, so they're called before it's moved out
+    template<typename TCfg>
+    TCfg postProcessConfig(Schema<TCfg>& schema, const std::vector<detail::IValidator*>& validators)
+    {
+        auto& cfg = schema.cfg();
+        try {
+            PostProcessor<TCfg>{}(cfg);
+        }
+        catch (const ValidationError& e) {
+            throw ConfigError{std::string{"Config is invalid: "} + e.what()};
+        }
+
+        detail::parallelForDynamic(
+                validators.size(),
+                detail::workerCount(validatorParallelism_.threadCount, validators.size()),
+                [&](std::size_t index, std::size_t)
+                {
+                    validators[index]->validate();
+                });
+
+        auto result = std::move(cfg);
+        if constexpr (std::is_base_of_v<figcone::Config, TCfg>)
+            resetConfigReader(result);
+        return result;
     }
 
 private:
     template<typename TConfigReaderPtr>
     friend class detail::ConfigReaderAccess;
+    template<typename TCfg>
+    friend class ReloadableConfig;
+    friend class ConfigReaderPool;
 
 private:
     std::map<std::string, std::unique_ptr<detail::INode>> nodes_;
     std::map<std::string, std::unique_ptr<detail::IParam>> params_;
+    std::optional<detail::FieldIndex<detail::INode>> nodeIndex_;
+    std::optional<detail::FieldIndex<detail::IParam>> paramIndex_;
+    std::unordered_map<const void*, std::string> fieldNames_;
     std::map<std::string, std::unique_ptr<ConfigReader>> nestedReaders_;
+    std::map<std::string, std::unique_ptr<ConfigReader>> nodeListReaders_;
     std::vector<std::unique_ptr<detail::IValidator>> validators_;
     NameFormat nameFormat_;
+    NodeListParallelism nodeListParallelism_;
+    ValidatorParallelism validatorParallelism_;
+    std::vector<detail::IValidator*>* validatorList_ = nullptr;
+    std::shared_ptr<TreeCache> treeCache_;
+    std::unique_ptr<detail::ConfigSchemaPool> schemaPool_;
+    ConfigOverlay overlay_;
+    const detail::OverlayNode* overlayNode_ = nullptr;
+    std::optional<std::unordered_map<std::string, std::string>> overlayIndex_;
+};
+
+
+template<typename TCfg>
+class ConfigReader::Schema : public detail::IConfigSchema {
+public:
+    Schema(NameFormat nameFormat, NodeListParallelism nodeListParallelism)
+        : reader_{nameFormat, nodeListParallelism}
+        , cfg_{makeConfig(reader_)}
+    {
+        if constexpr (!std::is_base_of_v<figcone::Config, TCfg>)
+            reader_.loadStructure(cfg_);
+    }
+
+    ConfigReader& reader()
+    {
+        return reader_;
+    }
+
+    TCfg& cfg()
+    {
+        return cfg_;
+    }
+
+private:
+    static TCfg makeConfig(ConfigReader& reader)
+    {
+        if constexpr (std::is_base_of_v<figcone::Config, TCfg>)
+            return TCfg{reader.makePtr()};
+        else
+            return TCfg{};
+    }
+
+private:
+    ConfigReader reader_;
+    TCfg cfg_;
 };
 
 } //namespace figcone
@@ -0,0 +1,133 @@
+#ifndef FIGCONE_CONFIGREADERPOOL_H
+#define FIGCONE_CONFIGREADERPOOL_H
+
+#include "configreader.h"
+#include "nameformat.h"
+#include <figcone_tree/iparser.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+
+//Pool of config readers for reading many small configs from multiple threads.
+//Each read leases a reader with its own parser and stream, which are returned to the pool afterwards, so the
+//schemas of the reader, the parser and the stream buffer stay allocated and are reused by the next reads.
+//The pool grows to the number of threads reading at the same time.
+class ConfigReaderPool {
+    struct Entry {
+        Entry(std::unique_ptr<IParser> parser, NameFormat nameFormat)
+            : reader{nameFormat}
+            , parser{std::move(parser)}
+        {
+        }
+
+        ConfigReader reader;
+        std::unique_ptr<IParser> parser;
+        std::istringstream stream;
+    };
+
+public:
+    class Lease {
+    public:
+        Lease(ConfigReaderPool& pool, std::unique_ptr<Entry> entry)
+            : pool_{&pool}
+            , entry_{std::move(entry)}
+        {
+        }
+
+        ~Lease()
+        {
+            if (entry_)
+                pool_->release(std::move(entry_));
+        }
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease(Lease&&) = default;
+        Lease& operator=(Lease&&) = delete;
+
+        ConfigReader& reader() const
+        {
+            return entry_->reader;
+        }
+
+        IParser& parser() const
+        {
+            return *entry_->parser;
+        }
+
+        template<typename TCfg, RootType rootType = RootType::SingleNode>
+        auto read(const std::string& configContent) const
+                -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+        {
+            //the stream keeps its buffer between the reads
+            entry_->stream.clear();
+            entry_->stream.str(configContent);
+            return entry_->reader.read<TCfg, rootType>(entry_->stream, *entry_->parser);
+        }
+
+    private:
+        ConfigReaderPool* pool_;
+        std::unique_ptr<Entry> entry_;
+    };
+
+    //parserFactory is called for each reader added to the pool and must return a pointer to IParser implementation
+    template<typename TParserFactory>
+    explicit ConfigReaderPool(TParserFactory parserFactory, NameFormat nameFormat = NameFormat::Original)
+        : parserFactory_{std::move(parserFactory)}
+        , nameFormat_{nameFormat}
+    {
+    }
+
+    ConfigReaderPool(const ConfigReaderPool&) = delete;
+    ConfigReaderPool& operator=(const ConfigReaderPool&) = delete;
+
+    //The pool must outlive the lease
+    Lease acquire()
+    {
+        {
+            auto lock = std::lock_guard{mutex_};
+            if (!idleEntries_.empty()) {
+                auto entry = std::move(idleEntries_.back());
+                idleEntries_.pop_back();
+                return Lease{*this, std::move(entry)};
+            }
+        }
+        return Lease{*this, std::make_unique<Entry>(parserFactory_(), nameFormat_)};
+    }
+
+    template<typename TCfg, RootType rootType = RootType::SingleNode>
+    auto read(const std::string& configContent)
+            -> std::conditional_t<rootType == RootType::SingleNode, TCfg, std::vector<TCfg>>
+    {
+        return acquire().read<TCfg, rootType>(configContent);
+    }
+
+private:
+    void release(std::unique_ptr<Entry> entry) noexcept
+    {
+        try {
+            auto lock = std::lock_guard{mutex_};
+            idleEntries_.emplace_back(std::move(entry));
+        }
+        catch (...) {
+            //the entry is destroyed and will be created again by the next read
+        }
+    }
+
+private:
+    std::function<std::unique_ptr<IParser>()> parserFactory_;
+    NameFormat nameFormat_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Entry>> idleEntries_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_CONFIGREADERPOOL_H
\ No newline at end of file
@@ -0,0 +1,106 @@
+#ifndef FIGCONE_ASYNCTASK_H
+#define FIGCONE_ASYNCTASK_H
+
+#include <figcone/executor.h>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#endif
+
+namespace figcone::detail {
+
+inline void execute(const Executor& executor, std::function<void()> task)
+{
+    if (executor)
+        executor(std::move(task));
+    else
+        std::thread{std::move(task)}.detach();
+}
+
+template<typename T>
+std::future<T> runAsync(const Executor& executor, std::function<T()> task)
+{
+    auto promise = std::make_shared<std::promise<T>>();
+    auto result = promise->get_future();
+    execute(executor,
+            [promise, task = std::move(task)]
+            {
+                try {
+                    promise->set_value(task());
+                }
+                catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+            });
+    return result;
+}
+
+#ifdef __cpp_impl_coroutine
+//Awaitable running the task on the executor and resuming the awaiting coroutine on the resume executor,
+//or on the thread that ran the task if the resume executor is empty
+template<typename T>
+class AsyncTaskAwaitable {
+public:
+    AsyncTaskAwaitable(std::function<T()> task, Executor executor, Executor resumeExecutor)
+        : task_{std::move(task)}
+        , executor_{std::move(executor)}
+        , resumeExecutor_{std::move(resumeExecutor)}
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        //the awaitable can be destroyed as soon as the coroutine is resumed, so the executor is moved out of it
+        auto executor = std::move(executor_);
+        execute(executor,
+                [this, handle]
+                {
+                    try {
+                        result_.emplace(task_());
+                    }
+                    catch (...) {
+                        exception_ = std::current_exception();
+                    }
+                    if (resumeExecutor_) {
+                        auto resumeExecutor = std::move(resumeExecutor_);
+                        resumeExecutor(
+                                [handle]
+                                {
+                                    handle.resume();
+                                });
+                    }
+                    else
+                        handle.resume();
+                });
+    }
+
+    T await_resume()
+    {
+        if (exception_)
+            std::rethrow_exception(exception_);
+        return std::move(*result_);
+    }
+
+private:
+    std::function<T()> task_;
+    Executor executor_;
+    Executor resumeExecutor_;
+    std::optional<T> result_;
+    std::exception_ptr exception_;
+};
+#endif
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_ASYNCTASK_H
\ No newline at end of file
@@ -0,0 +1,215 @@
+#ifndef FIGCONE_CONFIGLISTSPLITTER_H
+#define FIGCONE_CONFIGLISTSPLITTER_H
+
+#include <figcone/configlistformat.h>
+#include <figcone/errors.h>
+#include <figcone_tree/streamposition.h>
+#include <algorithm>
+#include <cctype>
+#include <istream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace figcone::detail {
+
+struct ConfigListElement {
+    std::string text;
+    StreamPosition position;
+};
+
+//Reads a stream of multiple configs one config at a time without parsing them
+class ConfigListSplitter {
+    enum class JsonLayout {
+        Array,
+        Lines
+    };
+
+public:
+    explicit ConfigListSplitter(ConfigListFormat format)
+        : format_{format}
+    {
+    }
+
+    std::optional<ConfigListElement> next(std::istream& stream)
+    {
+        if (format_ == ConfigListFormat::Yaml)
+            return nextYamlDocument(stream);
+
+        if (!jsonLayout_)
+            jsonLayout_ = readJsonLayout(stream);
+        if (jsonLayout_ == JsonLayout::Array)
+            return nextJsonArrayElement(stream);
+        return nextLine(stream);
+    }
+
+private:
+    int get(std::istream& stream)
+    {
+        const auto ch = stream.get();
+        if (ch == '\n') {
+            ++line_;
+            column_ = 1;
+        }
+        else if (ch != std::istream::traits_type::eof())
+            ++column_;
+        return ch;
+    }
+
+    void skipWhitespace(std::istream& stream)
+    {
+        while (std::isspace(stream.peek()))
+            get(stream);
+    }
+
+    JsonLayout readJsonLayout(std::istream& stream)
+    {
+        skipWhitespace(stream);
+        if (stream.peek() != '[')
+            return JsonLayout::Lines;
+
+        get(stream);
+        return JsonLayout::Array;
+    }
+
+    std::optional<ConfigListElement> nextJsonArrayElement(std::istream& stream)
+    {
+        if (isFinished_) {
+            checkJsonArrayEnd(stream);
+            return std::nullopt;
+        }
+
+        skipWhitespace(stream);
+        auto element = ConfigListElement{{}, StreamPosition{line_, column_}};
+        auto depth = 0;
+        auto isInString = false;
+        auto isEscaped = false;
+        while (true) {
+            const auto ch = get(stream);
+            if (ch == std::istream::traits_type::eof())
+                throw ConfigError{"JSON list must be closed with ']'", StreamPosition{line_, column_}};
+
+            if (isInString) {
+                if (isEscaped)
+                    isEscaped = false;
+                else if (ch == '\\')
+                    isEscaped = true;
+                else if (ch == '"')
+                    isInString = false;
+            }
+            else if (ch == '"')
+                isInString = true;
+            else if (ch == '{' || ch == '[')
+                ++depth;
+            else if ((ch == '}' || ch == ']') && depth > 0)
+                --depth;
+            else if (ch == ']' || (ch == ',' && depth == 0)) {
+                isFinished_ = (ch == ']');
+                break;
+            }
+            element.text.push_back(static_cast<char>(ch));
+        }
+
+        element.text.erase(element.text.find_last_not_of(" \t\r\n") + 1);
+        if (element.text.empty()) {
+            if (isFinished_) {
+                checkJsonArrayEnd(stream);
+                return std::nullopt;
+            }
+            throw ConfigError{"JSON list element can't be empty", element.position};
+        }
+        return element;
+    }
+
+    void checkJsonArrayEnd(std::istream& stream)
+    {
+        skipWhitespace(stream);
+        if (stream.peek() != std::istream::traits_type::eof())
+            throw ConfigError{"Unexpected content after the end of JSON list", StreamPosition{line_, column_}};
+    }
+
+    std::optional<ConfigListElement> nextLine(std::istream& stream)
+    {
+        auto element = ConfigListElement{};
+        while (true) {
+            element.position = StreamPosition{line_, column_};
+            if (!std::getline(stream, element.text))
+                return std::nullopt;
+            ++line_;
+            column_ = 1;
+            if (element.text.find_first_not_of(" \t\r") != std::string::npos)
+                return element;
+        }
+    }
+
+    std::optional<ConfigListElement> nextYamlDocument(std::istream& stream)
+    {
+        auto document = std::exchange(nextYamlDocument_, ConfigListElement{});
+        auto lineText = std::string{};
+        while (std::getline(stream, lineText)) {
+            const auto lineNumber = line_++;
+            if (isYamlMarker(lineText, "---")) {
+                //the document start marker can be followed by the document content on the same line
+                const auto contentPos = lineText.find_first_not_of(" \t\r", 3);
+                auto nextDocument = ConfigListElement{};
+                if (contentPos != std::string::npos)
+                    nextDocument = ConfigListElement{
+                            lineText.substr(contentPos) + "\n",
+                            StreamPosition{lineNumber, static_cast<int>(contentPos) + 1}};
+                if (hasYamlContent(document.text)) {
+                    nextYamlDocument_ = std::move(nextDocument);
+                    return document;
+                }
+                document = std::move(nextDocument);
+                continue;
+            }
+            if (isYamlMarker(lineText, "...")) {
+                if (hasYamlContent(document.text))
+                    return document;
+                document = ConfigListElement{};
+                continue;
+            }
+
+            if (document.text.empty())
+                document.position = StreamPosition{lineNumber, 1};
+            document.text += lineText;
+            document.text += '\n';
+        }
+
+        if (hasYamlContent(document.text))
+            return document;
+        return std::nullopt;
+    }
+
+    static bool isYamlMarker(std::string_view line, std::string_view marker)
+    {
+        return line.substr(0, marker.size()) == marker &&
+                (line.size() == marker.size() || std::isspace(static_cast<unsigned char>(line[marker.size()])));
+    }
+
+    static bool hasYamlContent(std::string_view text)
+    {
+        auto pos = std::size_t{};
+        while (pos < text.size()) {
+            const auto lineEnd = std::min(text.find('\n', pos), text.size());
+            const auto contentPos = text.find_first_not_of(" \t\r", pos);
+            if (contentPos < lineEnd && text[contentPos] != '#' && text[contentPos] != '%')
+                return true;
+            pos = lineEnd + 1;
+        }
+        return false;
+    }
+
+private:
+    ConfigListFormat format_;
+    std::optional<JsonLayout> jsonLayout_;
+    bool isFinished_ = false;
+    int line_ = 1;
+    int column_ = 1;
+    ConfigListElement nextYamlDocument_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_CONFIGLISTSPLITTER_H
\ No newline at end of file
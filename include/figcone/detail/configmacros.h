@@ -2,17 +2,33 @@
 #define FIGCONE_CONFIGMACROS_H
 
 #include "dictcreator.h"
+#include "nameutils.h"
 #include "nodecreator.h"
 #include "nodelistcreator.h"
 #include "paramcreator.h"
 #include "paramlistcreator.h"
 
-#define FIGCONE_PARAM(name, type) type name = param<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_NODE(name, type) type name = node<&std::remove_pointer_t<decltype(this)>::name>(#name)
+#define FIGCONE_DETAIL_FIELD_NAME(name)                                                                                \
+    figcone::detail::FieldName                                                                                         \
+    {                                                                                                                  \
+        #name, [](figcone::NameFormat nameFormat)                                                                      \
+        {                                                                                                              \
+            static constexpr auto names = figcone::detail::ConvertedNames<sizeof(#name) - 1>{#name};                   \
+            return names.get(nameFormat);                                                                              \
+        }                                                                                                              \
+    }
+
+#define FIGCONE_PARAM(name, type)                                                                                      \
+    type name = param<&std::remove_pointer_t<decltype(this)>::name>(FIGCONE_DETAIL_FIELD_NAME(name))
+#define FIGCONE_NODE(name, type)                                                                                       \
+    type name = node<&std::remove_pointer_t<decltype(this)>::name>(FIGCONE_DETAIL_FIELD_NAME(name))
 #define FIGCONE_COPY_NODELIST(name, listType)                                                                          \
-    listType name = copyNodeList<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_NODELIST(name, listType) listType name = nodeList<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_PARAMLIST(name, listType) listType name = paramList<&std::remove_pointer_t<decltype(this)>::name>(#name)
-#define FIGCONE_DICT(name, mapType) mapType name = dict<&std::remove_pointer_t<decltype(this)>::name>(#name)
+    listType name = copyNodeList<&std::remove_pointer_t<decltype(this)>::name>(FIGCONE_DETAIL_FIELD_NAME(name))
+#define FIGCONE_NODELIST(name, listType)                                                                               \
+    listType name = nodeList<&std::remove_pointer_t<decltype(this)>::name>(FIGCONE_DETAIL_FIELD_NAME(name))
+#define FIGCONE_PARAMLIST(name, listType)                                                                              \
+    listType name = paramList<&std::remove_pointer_t<decltype(this)>::name>(FIGCONE_DETAIL_FIELD_NAME(name))
+#define FIGCONE_DICT(name, mapType)                                                                                    \
+    mapType name = dict<&std::remove_pointer_t<decltype(this)>::name>(FIGCONE_DETAIL_FIELD_NAME(name))
 
 #endif //FIGCONE_CONFIGMACROS_H
\ No newline at end of file
@@ -2,14 +2,18 @@
 #define FIGCONE_CONFIGREADERACCESS_H
 
 #include "configreaderptr.h"
+#include <figcone/nodelistparallelism.h>
 #include <memory>
-#include <string>
+#include <string_view>
 
 namespace figcone {
 class TreeNode;
 }
 
 namespace figcone::detail {
+class ConfigSnapshotReader;
+class ConfigSnapshotWriter;
+class FieldName;
 class INode;
 class IParam;
 class IValidator;
@@ -22,14 +26,14 @@ public:
     {
     }
 
-    void addNode(const std::string& name, std::unique_ptr<detail::INode> node)
+    void addNode(const FieldName& name, std::unique_ptr<detail::INode> node, const void* field)
     {
-        configReader_->addNode(name, std::move(node));
+        configReader_->addNode(name, std::move(node), field);
     }
 
-    void addParam(const std::string& name, std::unique_ptr<detail::IParam> param)
+    void addParam(const FieldName& name, std::unique_ptr<detail::IParam> param, const void* field)
     {
-        configReader_->addParam(name, std::move(param));
+        configReader_->addParam(name, std::move(param), field);
     }
 
     void addValidator(std::unique_ptr<detail::IValidator> validator)
@@ -43,17 +47,58 @@ public:
         configReader_->template load<TCfg>(treeNode);
     }
 
+    bool loadChanges(const TreeNode& previousNode, const TreeNode& node)
+    {
+        return configReader_->loadChanges(previousNode, node);
+    }
+
+    void reset()
+    {
+        configReader_->reset();
+    }
+
+    bool writeSnapshot(ConfigSnapshotWriter& writer)
+    {
+        return configReader_->writeSnapshot(writer);
+    }
+
+    void readSnapshot(ConfigSnapshotReader& reader)
+    {
+        configReader_->readSnapshot(reader);
+    }
+
+    bool writeSchema(ConfigSnapshotWriter& writer)
+    {
+        return configReader_->writeSchema(writer);
+    }
+
     template<typename TCfg>
     void loadStructure(TCfg& cfg)
     {
         configReader_->template loadStructure<TCfg>(cfg);
     }
 
-    detail::ConfigReaderPtr makeNestedReader(const std::string& name)
+    detail::ConfigReaderPtr makeNestedReader(std::string_view name)
     {
         return configReader_->makeNestedReader(name);
     }
 
+    detail::ConfigReaderPtr makeNodeListReader(std::string_view name)
+    {
+        return configReader_->makeNodeListReader(name);
+    }
+
+    const NodeListParallelism& nodeListParallelism() const
+    {
+        return configReader_->nodeListParallelism();
+    }
+
+    template<typename TCfg>
+    auto acquireSchema()
+    {
+        return configReader_->template acquireSchema<TCfg>();
+    }
+
 private:
     TConfigReaderPtr configReader_;
 };
@@ -0,0 +1,86 @@
+#ifndef FIGCONE_CONFIGSCHEMAPOOL_H
+#define FIGCONE_CONFIGSCHEMAPOOL_H
+
+#include "iconfigschema.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace figcone::detail {
+
+class ConfigSchemaPool {
+public:
+    template<typename TSchema>
+    class Lease {
+    public:
+        Lease(ConfigSchemaPool& pool, std::unique_ptr<IConfigSchema> schema)
+            : pool_{&pool}
+            , schema_{std::move(schema)}
+        {
+        }
+
+        ~Lease()
+        {
+            if (schema_)
+                pool_->release(typeid(TSchema), std::move(schema_));
+        }
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease(Lease&&) = default;
+        Lease& operator=(Lease&&) = delete;
+
+        TSchema& operator*() const
+        {
+            return static_cast<TSchema&>(*schema_);
+        }
+
+        TSchema* operator->() const
+        {
+            return &**this;
+        }
+
+    private:
+        ConfigSchemaPool* pool_;
+        std::unique_ptr<IConfigSchema> schema_;
+    };
+
+    template<typename TSchema, typename TSchemaFactory>
+    Lease<TSchema> acquire(TSchemaFactory&& schemaFactory)
+    {
+        {
+            auto lock = std::lock_guard{mutex_};
+            auto& idleSchemas = idleSchemas_[typeid(TSchema)];
+            if (!idleSchemas.empty()) {
+                auto schema = std::move(idleSchemas.back());
+                idleSchemas.pop_back();
+                return Lease<TSchema>{*this, std::move(schema)};
+            }
+        }
+        return Lease<TSchema>{*this, std::forward<TSchemaFactory>(schemaFactory)()};
+    }
+
+private:
+    void release(std::type_index schemaType, std::unique_ptr<IConfigSchema> schema) noexcept
+    {
+        try {
+            auto lock = std::lock_guard{mutex_};
+            idleSchemas_[schemaType].emplace_back(std::move(schema));
+        }
+        catch (...) {
+            //the schema is destroyed and will be created again by the next read
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::type_index, std::vector<std::unique_ptr<IConfigSchema>>> idleSchemas_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_CONFIGSCHEMAPOOL_H
\ No newline at end of file
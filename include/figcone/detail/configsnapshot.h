@@ -0,0 +1,273 @@
+#ifndef FIGCONE_CONFIGSNAPSHOT_H
+#define FIGCONE_CONFIGSNAPSHOT_H
+
+#include "snapshotdata.h"
+#include "external/eel/type_traits.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace figcone::detail {
+
+namespace config_snapshot {
+inline constexpr auto magic = std::string_view{"FIGCONE\x04", 8};
+} //namespace config_snapshot
+
+//Returns true if the values of type T can be stored in a config snapshot exactly
+template<typename T>
+constexpr bool isSnapshotValue()
+{
+    if constexpr (
+            std::is_integral_v<T> || std::is_enum_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double> ||
+            std::is_same_v<T, std::string>)
+        return true;
+    else if constexpr (eel::is_optional_v<T>)
+        return isSnapshotValue<typename T::value_type>();
+    else if constexpr (eel::is_associative_container_v<T>)
+        return std::is_same_v<typename T::key_type, std::string> && isSnapshotValue<typename T::mapped_type>();
+    else if constexpr (eel::is_dynamic_sequence_container_v<T>)
+        return isSnapshotValue<typename T::value_type>();
+    else
+        return false;
+}
+
+//Serializes the values of a bound config, so it can be restored without parsing and loading the config again.
+//Content: table of field names and types, fields of the config in the order of their registration in config readers.
+//Each field is stored as an index in the fields table followed by its value.
+//Snapshot file layout: magic, key, config type, number of configs of the document, content of each config.
+class ConfigSnapshotWriter {
+public:
+    void writeField(const std::string& name, const std::type_info& type)
+    {
+        auto [it, isInserted] = fieldIndex_.emplace(FieldKey{&name, &type}, fields_.size());
+        if (isInserted)
+            fields_.emplace_back(&name, &type);
+        data_.writeInt(it->second);
+    }
+
+    void writeCount(std::size_t count)
+    {
+        data_.writeInt(count);
+    }
+
+    template<typename T>
+    void writeValue(const T& value)
+    {
+        static_assert(isSnapshotValue<T>());
+        if constexpr (std::is_same_v<T, bool>)
+            data_.writeInt(value ? 1 : 0);
+        else if constexpr (std::is_enum_v<T>)
+            writeValue(static_cast<std::underlying_type_t<T>>(value));
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            const auto intValue = static_cast<std::int64_t>(value);
+            data_.writeInt((static_cast<std::uint64_t>(intValue) << 1) ^ (intValue < 0 ? ~std::uint64_t{} : 0));
+        }
+        else if constexpr (std::is_integral_v<T>)
+            data_.writeInt(static_cast<std::uint64_t>(value));
+        else if constexpr (std::is_floating_point_v<T>) {
+            char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            data_.writeBytes(std::string_view{bytes, sizeof(T)});
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+            data_.writeString(value);
+        else if constexpr (eel::is_optional_v<T>) {
+            writeValue(value.has_value());
+            if (value.has_value())
+                writeValue(*value);
+        }
+        else if constexpr (eel::is_associative_container_v<T>) {
+            writeCount(value.size());
+            for (const auto& [key, mappedValue] : value) {
+                data_.writeString(key);
+                writeValue(mappedValue);
+            }
+        }
+        else {
+            writeCount(value.size());
+            for (const auto& element : value)
+                writeValue(element);
+        }
+    }
+
+    //Returns false if the schema of the config type has already been written
+    bool addSchemaType(const std::type_info& type)
+    {
+        return schemaTypes_.emplace(type).second;
+    }
+
+    std::string finish() &&
+    {
+        auto content = SnapshotDataWriter{};
+        content.writeInt(fields_.size());
+        for (const auto& [name, type] : fields_) {
+            content.writeString(*name);
+            content.writeString(type->name());
+        }
+        content.writeBytes(data_.data());
+        return content.data();
+    }
+
+private:
+    using FieldKey = std::pair<const std::string*, const std::type_info*>;
+
+    struct FieldKeyHash {
+        std::size_t operator()(const FieldKey& key) const
+        {
+            return std::hash<const void*>{}(key.first) ^ (std::hash<const void*>{}(key.second) << 1);
+        }
+    };
+
+private:
+    SnapshotDataWriter data_;
+    std::unordered_map<FieldKey, std::size_t, FieldKeyHash> fieldIndex_;
+    std::vector<FieldKey> fields_;
+    std::unordered_set<std::type_index> schemaTypes_;
+};
+
+class ConfigSnapshotReader {
+public:
+    using ReadError = SnapshotDataReader::ReadError;
+
+    //returns std::nullopt if the content written by ConfigSnapshotWriter is damaged
+    static std::optional<ConfigSnapshotReader> open(std::string_view content)
+    {
+        auto reader = ConfigSnapshotReader{SnapshotDataReader{content}};
+        try {
+            const auto fieldCount = reader.data_.readCount();
+            reader.fields_.resize(fieldCount);
+            for (auto& field : reader.fields_) {
+                field.name = reader.data_.readString();
+                field.typeName = reader.data_.readString();
+            }
+        }
+        catch (const ReadError&) {
+            return std::nullopt;
+        }
+        return reader;
+    }
+
+    //throws ReadError if the next stored field has another name or type
+    void readField(const std::string& name, const std::type_info& type)
+    {
+        const auto index = data_.readInt();
+        if (index >= fields_.size())
+            throw ReadError{};
+        auto& field = fields_[static_cast<std::size_t>(index)];
+        if (field.name != name)
+            throw ReadError{};
+        if (field.type == &type)
+            return;
+        if (field.typeName != type.name())
+            throw ReadError{};
+        field.type = &type;
+    }
+
+    std::size_t readCount()
+    {
+        return data_.readCount();
+    }
+
+    template<typename T>
+    void readValue(T& value)
+    {
+        static_assert(isSnapshotValue<T>());
+        if constexpr (std::is_same_v<T, bool>) {
+            const auto intValue = data_.readInt();
+            if (intValue > 1)
+                throw ReadError{};
+            value = intValue == 1;
+        }
+        else if constexpr (std::is_enum_v<T>) {
+            auto underlyingValue = std::underlying_type_t<T>{};
+            readValue(underlyingValue);
+            value = static_cast<T>(underlyingValue);
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            const auto encodedValue = data_.readInt();
+            const auto intValue =
+                    static_cast<std::int64_t>(encodedValue >> 1) ^ -static_cast<std::int64_t>(encodedValue & 1);
+            if constexpr (sizeof(T) < sizeof(std::int64_t))
+                if (intValue < std::numeric_limits<T>::min() || intValue > std::numeric_limits<T>::max())
+                    throw ReadError{};
+            value = static_cast<T>(intValue);
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            const auto intValue = data_.readInt();
+            if constexpr (sizeof(T) < sizeof(std::uint64_t))
+                if (intValue > std::numeric_limits<T>::max())
+                    throw ReadError{};
+            value = static_cast<T>(intValue);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+            std::memcpy(&value, data_.readBytes(sizeof(T)).data(), sizeof(T));
+        else if constexpr (std::is_same_v<T, std::string>)
+            value = data_.readString();
+        else if constexpr (eel::is_optional_v<T>) {
+            auto hasValue = false;
+            readValue(hasValue);
+            if (!hasValue) {
+                value.reset();
+                return;
+            }
+            value.emplace();
+            readValue(*value);
+        }
+        else if constexpr (eel::is_associative_container_v<T>) {
+            value.clear();
+            const auto count = readCount();
+            for (auto i = std::size_t{}; i < count; ++i) {
+                auto key = data_.readString();
+                auto mappedValue = typename T::mapped_type{};
+                readValue(mappedValue);
+                value.emplace(std::move(key), std::move(mappedValue));
+            }
+        }
+        else {
+            value.clear();
+            const auto count = readCount();
+            for (auto i = std::size_t{}; i < count; ++i) {
+                auto element = typename T::value_type{};
+                readValue(element);
+                value.emplace_back(std::move(element));
+            }
+        }
+    }
+
+    bool isFinished() const
+    {
+        return data_.isFinished();
+    }
+
+private:
+    explicit ConfigSnapshotReader(const SnapshotDataReader& data)
+        : data_{data}
+    {
+    }
+
+    struct Field {
+        std::string name;
+        std::string typeName;
+        const std::type_info* type = nullptr;
+    };
+
+private:
+    SnapshotDataReader data_;
+    std::vector<Field> fields_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_CONFIGSNAPSHOT_H
\ No newline at end of file
@@ -0,0 +1,244 @@
+#ifndef FIGCONE_DECOMPRESSINGSTREAM_H
+#define FIGCONE_DECOMPRESSINGSTREAM_H
+
+#include <figcone/errors.h>
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef FIGCONE_ZLIB_AVAILABLE
+#include <zlib.h>
+#endif
+
+#ifdef FIGCONE_ZSTD_AVAILABLE
+#include <zstd.h>
+#endif
+
+namespace figcone::detail {
+
+enum class CompressionFormat {
+    None,
+    Gzip,
+    Zstd
+};
+
+inline CompressionFormat detectCompressionFormat(std::string_view data)
+{
+    using namespace std::string_view_literals;
+    if (data.substr(0, 2) == "\x1F\x8B"sv)
+        return CompressionFormat::Gzip;
+    if (data.substr(0, 4) == "\x28\xB5\x2F\xFD"sv)
+        return CompressionFormat::Zstd;
+    return CompressionFormat::None;
+}
+
+inline constexpr auto decompressionBufferSize = std::size_t{64 * 1024};
+
+//Reads compressed data from the source stream and provides the decompressed data one buffer at a time.
+//Decompression errors are thrown as ConfigError from the streams, which have badbit set in their exception mask.
+template<typename TDecoder>
+class DecompressingStreamBuf : public std::streambuf {
+public:
+    explicit DecompressingStreamBuf(std::unique_ptr<std::istream> source)
+        : source_{std::move(source)}
+        , input_(decompressionBufferSize)
+        , output_(decompressionBufferSize)
+    {
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+
+        while (true) {
+            if (inputData_.empty() && !hasPendingOutput_) {
+                if (isSourceFinished_) {
+                    decoder_.finish();
+                    return traits_type::eof();
+                }
+                readInput();
+                continue;
+            }
+
+            const auto outputSize = decoder_.decode(inputData_, output_.data(), output_.size());
+            //the decoder can hold more decompressed data when the output buffer is filled completely
+            hasPendingOutput_ = outputSize == output_.size();
+            if (outputSize) {
+                setg(output_.data(), output_.data(), output_.data() + outputSize);
+                return traits_type::to_int_type(*gptr());
+            }
+        }
+    }
+
+private:
+    void readInput()
+    {
+        source_->read(input_.data(), static_cast<std::streamsize>(input_.size()));
+        if (source_->bad())
+            throw ConfigError{"Can't read compressed config data"};
+        inputData_ = std::string_view{input_.data(), static_cast<std::size_t>(source_->gcount())};
+        isSourceFinished_ = inputData_.size() < input_.size();
+    }
+
+    std::unique_ptr<std::istream> source_;
+    TDecoder decoder_;
+    std::vector<char> input_;
+    std::vector<char> output_;
+    std::string_view inputData_;
+    bool isSourceFinished_ = false;
+    bool hasPendingOutput_ = false;
+};
+
+template<typename TDecoder>
+class DecompressingStream : public std::istream {
+public:
+    explicit DecompressingStream(std::unique_ptr<std::istream> source)
+        : std::istream{nullptr}
+        , streamBuf_{std::move(source)}
+    {
+        rdbuf(&streamBuf_);
+        exceptions(std::ios_base::badbit);
+    }
+
+private:
+    DecompressingStreamBuf<TDecoder> streamBuf_;
+};
+
+#ifdef FIGCONE_ZLIB_AVAILABLE
+class GzipDecoder {
+public:
+    GzipDecoder()
+    {
+        //16 - decode gzip format only
+        if (inflateInit2(&stream_, 16 + MAX_WBITS) != Z_OK)
+            throw ConfigError{"Can't decompress gzip config: zlib initialization failed"};
+    }
+
+    ~GzipDecoder()
+    {
+        inflateEnd(&stream_);
+    }
+
+    GzipDecoder(const GzipDecoder&) = delete;
+    GzipDecoder& operator=(const GzipDecoder&) = delete;
+
+    //consumes the decoded part of input, returns the size of the decompressed data written to output
+    std::size_t decode(std::string_view& input, char* output, std::size_t outputSize)
+    {
+        //concatenated gzip members are decoded as a single stream, like gzip utility does
+        if (isMemberFinished_) {
+            if (input.empty())
+                return 0;
+            inflateReset(&stream_);
+            isMemberFinished_ = false;
+        }
+
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream_.avail_in = static_cast<uInt>(input.size());
+        stream_.next_out = reinterpret_cast<Bytef*>(output);
+        stream_.avail_out = static_cast<uInt>(outputSize);
+
+        const auto result = inflate(&stream_, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR)
+            throw ConfigError{
+                    "Can't decompress gzip config: " + std::string{stream_.msg ? stream_.msg : "invalid data"}};
+
+        isMemberFinished_ = result == Z_STREAM_END;
+        input.remove_prefix(input.size() - stream_.avail_in);
+        return outputSize - stream_.avail_out;
+    }
+
+    void finish() const
+    {
+        if (!isMemberFinished_)
+            throw ConfigError{"Can't decompress gzip config: unexpected end of data"};
+    }
+
+private:
+    z_stream stream_ = {};
+    bool isMemberFinished_ = false;
+};
+#endif
+
+#ifdef FIGCONE_ZSTD_AVAILABLE
+class ZstdDecoder {
+public:
+    ZstdDecoder()
+        : stream_{ZSTD_createDStream()}
+    {
+        if (!stream_)
+            throw ConfigError{"Can't decompress zstd config: zstd initialization failed"};
+    }
+
+    ~ZstdDecoder()
+    {
+        ZSTD_freeDStream(stream_);
+    }
+
+    ZstdDecoder(const ZstdDecoder&) = delete;
+    ZstdDecoder& operator=(const ZstdDecoder&) = delete;
+
+    //consumes the decoded part of input, returns the size of the decompressed data written to output
+    std::size_t decode(std::string_view& input, char* output, std::size_t outputSize)
+    {
+        auto inBuffer = ZSTD_inBuffer{input.data(), input.size(), 0};
+        auto outBuffer = ZSTD_outBuffer{output, outputSize, 0};
+        const auto result = ZSTD_decompressStream(stream_, &outBuffer, &inBuffer);
+        if (ZSTD_isError(result))
+            throw ConfigError{"Can't decompress zstd config: " + std::string{ZSTD_getErrorName(result)}};
+
+        //0 - the current frame is fully decoded and flushed
+        isFrameFinished_ = result == 0;
+        input.remove_prefix(inBuffer.pos);
+        return outBuffer.pos;
+    }
+
+    void finish() const
+    {
+        if (!isFrameFinished_)
+            throw ConfigError{"Can't decompress zstd config: unexpected end of data"};
+    }
+
+private:
+    ZSTD_DStream* stream_;
+    bool isFrameFinished_ = false;
+};
+#endif
+
+//Returns the source stream itself if its data isn't compressed
+inline std::unique_ptr<std::istream> makeDecompressingStream(std::unique_ptr<std::istream> source)
+{
+    auto header = std::array<char, 4>{};
+    source->read(header.data(), static_cast<std::streamsize>(header.size()));
+    const auto headerSize = static_cast<std::size_t>(source->gcount());
+    source->clear();
+    source->seekg(0);
+
+    switch (detectCompressionFormat(std::string_view{header.data(), headerSize})) {
+    case CompressionFormat::Gzip:
+#ifdef FIGCONE_ZLIB_AVAILABLE
+        return std::make_unique<DecompressingStream<GzipDecoder>>(std::move(source));
+#else
+        throw ConfigError{"Can't read gzip compressed config, figcone is built without zlib support"};
+#endif
+    case CompressionFormat::Zstd:
+#ifdef FIGCONE_ZSTD_AVAILABLE
+        return std::make_unique<DecompressingStream<ZstdDecoder>>(std::move(source));
+#else
+        throw ConfigError{"Can't read zstd compressed config, figcone is built without zstd support"};
+#endif
+    default:
+        return source;
+    }
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_DECOMPRESSINGSTREAM_H
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef FIGCONE_DICT_H
 #define FIGCONE_DICT_H
 
+#include "configsnapshot.h"
 #include "inode.h"
 #include "param.h"
 #include "utils.h"
@@ -9,6 +10,7 @@
 #include <map>
 #include <string>
 #include <type_traits>
+#include <typeinfo>
 
 namespace figcone::detail {
 
@@ -31,6 +33,7 @@ public:
     void markValueIsSet()
     {
         hasValue_ = true;
+        hasDefaultValue_ = true;
     }
 
 private:
@@ -47,18 +50,16 @@ private:
         for (const auto& paramName : node.asItem().paramNames()) {
             const auto& paramValue = node.asItem().param(paramName);
             using Param = typename eel::remove_optional_t<TMap>::mapped_type;
-            const auto paramNameStr = paramName;
-            const auto paramValueStr = paramValue;
-            auto paramReadResult = convertFromString<Param>(paramValueStr.value());
+            auto paramReadResult = convertFromString<Param>(paramValue.value());
             auto readResultVisitor = eel::overloaded{
-                    [&](const Param& param)
+                    [&](Param& param)
                     {
-                        maybeOptValue(dictMap_).emplace(paramNameStr, param);
+                        maybeOptValue(dictMap_).emplace(paramName, std::move(param));
                     },
                     [&](const StringConversionError& error)
                     {
                         throw ConfigError{
-                                "Couldn't set dict element'" + name_ + "' value from '" + paramValueStr.value() + "'" +
+                                "Couldn't set dict element'" + name_ + "' value from '" + paramValue.value() + "'" +
                                         (!error.message.empty() ? ": " + error.message : ""),
                                 position_};
                     }};
@@ -66,6 +67,11 @@ private:
         }
     }
 
+    bool loadChanges(const TreeNode&, const TreeNode&) override
+    {
+        return false;
+    }
+
     bool hasValue() const override
     {
         if constexpr (eel::is_optional_v<TMap>)
@@ -74,6 +80,37 @@ private:
             return hasValue_;
     }
 
+    void reset() override
+    {
+        hasValue_ = hasDefaultValue_;
+    }
+
+    bool writeSnapshot(ConfigSnapshotWriter& writer) override
+    {
+        if constexpr (isSnapshotValue<TMap>()) {
+            writer.writeField(name_, typeid(TMap));
+            writer.writeValue(dictMap_);
+            return true;
+        }
+        else
+            return false;
+    }
+
+    void readSnapshot(ConfigSnapshotReader& reader) override
+    {
+        if constexpr (isSnapshotValue<TMap>()) {
+            reader.readField(name_, typeid(TMap));
+            reader.readValue(dictMap_);
+        }
+        else
+            throw ConfigSnapshotReader::ReadError{};
+    }
+
+    bool writeSchema(ConfigSnapshotWriter& writer) override
+    {
+        return writeSnapshot(writer);
+    }
+
     StreamPosition position() override
     {
         return position_;
@@ -88,6 +125,7 @@ private:
     std::string name_;
     TMap& dictMap_;
     bool hasValue_ = false;
+    bool hasDefaultValue_ = false;
     StreamPosition position_;
 };
 
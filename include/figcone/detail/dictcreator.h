@@ -3,21 +3,23 @@
 
 #include "configreaderaccess.h"
 #include "dict.h"
+#include "nameutils.h"
 #include "validator.h"
 #include "external/eel/contract.h"
 #include "external/eel/type_traits.h"
 #include <figcone/nameformat.h>
 #include <memory>
+#include <string>
 
 namespace figcone::detail {
 
 template<typename TMap>
 class DictCreator {
 public:
-    DictCreator(ConfigReaderPtr cfgReader, std::string dictName, TMap& dictMap, bool isOptional = false)
+    DictCreator(ConfigReaderPtr cfgReader, FieldName dictName, TMap& dictMap, bool isOptional = false)
         : cfgReader_{cfgReader}
-        , dictName_{(eel::precondition(!dictName.empty(), FIGCONE_EEL_LINE), std::move(dictName))}
-        , dict_{std::make_unique<Dict<TMap>>(dictName_, dictMap)}
+        , dictName_{(eel::precondition(!dictName.name().empty(), FIGCONE_EEL_LINE), dictName)}
+        , dict_{cfgReader_ ? std::make_unique<Dict<TMap>>(std::string{dictName_.name()}, dictMap) : nullptr}
         , dictMap_{dictMap}
     {
         static_assert(
@@ -27,13 +29,14 @@ public:
         static_assert(
                 std::is_same_v<typename eel::remove_optional_t<TMap>::key_type, std::string>,
                 "Dictionary associative container's key type must be std::string");
-        if (isOptional)
+        if (isOptional && dict_)
             dict_->markValueIsSet();
     }
 
     DictCreator& operator()(TMap defaultValue = {})
     {
-        dict_->markValueIsSet();
+        if (dict_)
+            dict_->markValueIsSet();
         defaultValue_ = std::move(defaultValue);
         return *this;
     }
@@ -41,7 +44,7 @@ public:
     void createDict()
     {
         if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addNode(dictName_, std::move(dict_));
+            ConfigReaderAccess{cfgReader_}.addNode(dictName_, std::move(dict_), &dictMap_);
     }
 
     operator TMap()
@@ -69,7 +72,7 @@ public:
 
 private:
     ConfigReaderPtr cfgReader_;
-    std::string dictName_;
+    FieldName dictName_;
     std::unique_ptr<Dict<TMap>> dict_;
     TMap& dictMap_;
     TMap defaultValue_;
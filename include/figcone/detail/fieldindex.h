@@ -0,0 +1,65 @@
+#ifndef FIGCONE_FIELDINDEX_H
+#define FIGCONE_FIELDINDEX_H
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace figcone::detail {
+
+template<typename TField>
+class FieldIndex {
+    struct Entry {
+        std::size_t hash = 0;
+        std::string_view name;
+        TField* field = nullptr;
+    };
+
+public:
+    template<typename TFieldMap>
+    explicit FieldIndex(const TFieldMap& fields)
+        : entries_(capacity(fields.size()))
+        , mask_{entries_.size() - 1}
+    {
+        for (const auto& [name, field] : fields) {
+            const auto nameHash = hash(name);
+            auto pos = nameHash & mask_;
+            while (entries_[pos].field)
+                pos = (pos + 1) & mask_;
+            entries_[pos] = Entry{nameHash, name, field.get()};
+        }
+    }
+
+    TField* find(std::string_view name) const
+    {
+        const auto nameHash = hash(name);
+        for (auto pos = nameHash & mask_;; pos = (pos + 1) & mask_) {
+            const auto& entry = entries_[pos];
+            if (!entry.field || (entry.hash == nameHash && entry.name == name))
+                return entry.field;
+        }
+    }
+
+private:
+    static std::size_t hash(std::string_view name)
+    {
+        return std::hash<std::string_view>{}(name);
+    }
+
+    static std::size_t capacity(std::size_t size)
+    {
+        auto result = std::size_t{2};
+        while (result < size * 2)
+            result *= 2;
+        return result;
+    }
+
+private:
+    std::vector<Entry> entries_;
+    std::size_t mask_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FIELDINDEX_H
\ No newline at end of file
@@ -0,0 +1,252 @@
+#ifndef FIGCONE_FILEWATCHER_H
+#define FIGCONE_FILEWATCHER_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+
+#if __has_include(<sys/inotify.h>)
+#define FIGCONE_INOTIFY_AVAILABLE
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace figcone::detail {
+
+//Waits for changes of a file. Uses inotify on the file's directory, so replacing the file by renaming another one
+//is detected too. When the file is a symlink, the directory of its target is watched as well, and replacing any entry
+//of the watched directories is checked for changing the symlink's target, which is how Kubernetes updates mounted
+//config maps by swapping the "..data" symlink. If inotify isn't available, the file's modification time, size and
+//target are checked periodically.
+class FileWatcher {
+    struct FileState {
+        std::filesystem::file_time_type modificationTime;
+        std::uintmax_t size = 0;
+        std::filesystem::path target;
+
+        friend bool operator==(const FileState& lhs, const FileState& rhs)
+        {
+            return lhs.modificationTime == rhs.modificationTime && lhs.size == rhs.size && lhs.target == rhs.target;
+        }
+    };
+
+#ifdef FIGCONE_INOTIFY_AVAILABLE
+    static constexpr auto directoryEntryMask = IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM;
+    static constexpr auto watchMask = IN_CLOSE_WRITE | IN_MODIFY | directoryEntryMask;
+#endif
+
+public:
+    enum class WaitResult {
+        Changed,
+        Timeout,
+        Stopped
+    };
+
+    FileWatcher(std::filesystem::path file, std::chrono::milliseconds pollInterval)
+        : file_{std::move(file)}
+        , pollInterval_{pollInterval}
+        , fileState_{readFileState()}
+    {
+#ifdef FIGCONE_INOTIFY_AVAILABLE
+        inotifyFd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd_ == -1)
+            return;
+
+        const auto directory = file_.has_parent_path() ? file_.parent_path() : std::filesystem::path{"."};
+        fileDirectoryWatch_ = ::inotify_add_watch(inotifyFd_, directory.c_str(), watchMask);
+        if (fileDirectoryWatch_ == -1 || ::pipe2(stopPipe_, O_NONBLOCK | O_CLOEXEC) == -1) {
+            ::close(inotifyFd_);
+            inotifyFd_ = -1;
+            return;
+        }
+        updateTargetWatch();
+#endif
+    }
+
+    ~FileWatcher()
+    {
+#ifdef FIGCONE_INOTIFY_AVAILABLE
+        if (inotifyFd_ == -1)
+            return;
+        ::close(inotifyFd_);
+        ::close(stopPipe_[0]);
+        ::close(stopPipe_[1]);
+#endif
+    }
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    //Waits until the file changes, the timeout expires or the watcher is stopped, no timeout means waiting without
+    //a time limit
+    WaitResult wait(std::optional<std::chrono::milliseconds> timeout)
+    {
+#ifdef FIGCONE_INOTIFY_AVAILABLE
+        if (inotifyFd_ != -1)
+            return waitForEvents(timeout);
+#endif
+        return pollFileState(timeout);
+    }
+
+    void stop()
+    {
+        {
+            auto lock = std::lock_guard{mutex_};
+            isStopped_ = true;
+        }
+        stopCondition_.notify_all();
+#ifdef FIGCONE_INOTIFY_AVAILABLE
+        if (inotifyFd_ != -1) {
+            const auto stopByte = char{};
+            [[maybe_unused]] auto result = ::write(stopPipe_[1], &stopByte, 1);
+        }
+#endif
+    }
+
+private:
+#ifdef FIGCONE_INOTIFY_AVAILABLE
+    WaitResult waitForEvents(std::optional<std::chrono::milliseconds> timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout.value_or(std::chrono::milliseconds{});
+        for (;;) {
+            auto pollTimeout = -1;
+            if (timeout) {
+                pollTimeout = static_cast<int>(remainingTime(deadline).count());
+            }
+
+            pollfd fds[] = {{inotifyFd_, POLLIN, 0}, {stopPipe_[0], POLLIN, 0}};
+            const auto result = ::poll(fds, 2, pollTimeout);
+            if (result == -1 && errno == EINTR)
+                continue;
+            if (result == -1 || fds[1].revents)
+                return WaitResult::Stopped;
+            if (result == 0)
+                return WaitResult::Timeout;
+            if (readEvents())
+                return WaitResult::Changed;
+        }
+    }
+
+    //returns true if any of the read events is related to the watched file or changes its target
+    bool readEvents()
+    {
+        alignas(inotify_event) char buffer[4096];
+        auto isFileChanged = false;
+        auto isDirectoryChanged = false;
+        for (;;) {
+            const auto size = ::read(inotifyFd_, buffer, sizeof(buffer));
+            if (size <= 0)
+                break;
+
+            for (auto pos = ssize_t{}; pos < size;) {
+                auto event = reinterpret_cast<const inotify_event*>(buffer + pos);
+                if (event->mask & IN_Q_OVERFLOW)
+                    isFileChanged = true;
+                else if (event->len) {
+                    if ((event->wd == fileDirectoryWatch_ && file_.filename() == event->name) ||
+                        (event->wd == targetWatch_ && fileState_.target.filename() == event->name))
+                        isFileChanged = true;
+                    else if (event->mask & directoryEntryMask)
+                        isDirectoryChanged = true;
+                }
+                pos += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+            }
+        }
+
+        if (!isFileChanged && !isDirectoryChanged)
+            return false;
+        const auto fileState = readFileState();
+        if (!isFileChanged && fileState == fileState_)
+            return false;
+        fileState_ = fileState;
+        updateTargetWatch();
+        return true;
+    }
+
+    void updateTargetWatch()
+    {
+        const auto targetDirectory = fileState_.target.parent_path();
+        if (targetDirectory == targetDirectory_)
+            return;
+
+        if (targetWatch_ != -1 && targetWatch_ != fileDirectoryWatch_)
+            ::inotify_rm_watch(inotifyFd_, targetWatch_);
+        targetDirectory_ = targetDirectory;
+        targetWatch_ = -1;
+        if (!targetDirectory_.empty())
+            targetWatch_ = ::inotify_add_watch(inotifyFd_, targetDirectory_.c_str(), watchMask);
+    }
+#endif
+
+    WaitResult pollFileState(std::optional<std::chrono::milliseconds> timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout.value_or(std::chrono::milliseconds{});
+        auto lock = std::unique_lock{mutex_};
+        for (;;) {
+            auto interval = pollInterval_;
+            if (timeout)
+                interval = std::min(interval, remainingTime(deadline));
+            if (stopCondition_.wait_for(
+                        lock,
+                        interval,
+                        [this]
+                        {
+                            return isStopped_;
+                        }))
+                return WaitResult::Stopped;
+
+            const auto fileState = readFileState();
+            if (!(fileState == fileState_)) {
+                fileState_ = fileState;
+                return WaitResult::Changed;
+            }
+            if (timeout && std::chrono::steady_clock::now() >= deadline)
+                return WaitResult::Timeout;
+        }
+    }
+
+    static std::chrono::milliseconds remainingTime(std::chrono::steady_clock::time_point deadline)
+    {
+        const auto result =
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        return std::max(result, std::chrono::milliseconds{});
+    }
+
+    FileState readFileState() const
+    {
+        auto error = std::error_code{};
+        auto fileState = FileState{std::filesystem::last_write_time(file_, error), 0, {}};
+        fileState.size = std::filesystem::file_size(file_, error);
+        fileState.target = std::filesystem::canonical(file_, error);
+        return fileState;
+    }
+
+private:
+    std::filesystem::path file_;
+    std::chrono::milliseconds pollInterval_;
+    FileState fileState_;
+    std::mutex mutex_;
+    std::condition_variable stopCondition_;
+    bool isStopped_ = false;
+#ifdef FIGCONE_INOTIFY_AVAILABLE
+    int inotifyFd_ = -1;
+    int stopPipe_[2] = {-1, -1};
+    int fileDirectoryWatch_ = -1;
+    int targetWatch_ = -1;
+    std::filesystem::path targetDirectory_;
+#endif
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_FILEWATCHER_H
\ No newline at end of file
@@ -0,0 +1,12 @@
+#ifndef FIGCONE_ICONFIGSCHEMA_H
+#define FIGCONE_ICONFIGSCHEMA_H
+
+#include "external/eel/interface.h"
+
+namespace figcone::detail {
+
+class IConfigSchema : private eel::interface<IConfigSchema> {};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_ICONFIGSCHEMA_H
\ No newline at end of file
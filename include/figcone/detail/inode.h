@@ -7,11 +7,22 @@
 #include <string>
 
 namespace figcone::detail {
+class ConfigSnapshotReader;
+class ConfigSnapshotWriter;
 
 class INode : public IConfigEntity {
 public:
     virtual void load(const figcone::TreeNode& node) = 0;
+    //Loads only the fields that differ from the previously loaded node, returns false if the node must be loaded
+    //with load() instead
+    virtual bool loadChanges(const figcone::TreeNode& previousNode, const figcone::TreeNode& node) = 0;
     virtual bool hasValue() const = 0;
+    virtual void reset() = 0;
+    //Stores the loaded value in the config snapshot, returns false if its type can't be stored there
+    virtual bool writeSnapshot(ConfigSnapshotWriter& writer) = 0;
+    virtual void readSnapshot(ConfigSnapshotReader& reader) = 0;
+    //Stores the names, types and default values of the node fields, returns false if they can't be stored
+    virtual bool writeSchema(ConfigSnapshotWriter& writer) = 0;
 };
 
 } //namespace figcone::detail
@@ -5,11 +5,18 @@
 #include <figcone_tree/tree.h>
 
 namespace figcone::detail {
+class ConfigSnapshotReader;
+class ConfigSnapshotWriter;
 
 class IParam : public IConfigEntity {
 public:
     virtual void load(const figcone::TreeParam& node) = 0;
+    virtual bool isList() const = 0;
     virtual bool hasValue() const = 0;
+    virtual void reset() = 0;
+    //Stores the loaded value in the config snapshot, returns false if its type can't be stored there
+    virtual bool writeSnapshot(ConfigSnapshotWriter& writer) = 0;
+    virtual void readSnapshot(ConfigSnapshotReader& reader) = 0;
 };
 
 } //namespace figcone::detail
@@ -0,0 +1,82 @@
+#ifndef FIGCONE_MAPPEDFILE_H
+#define FIGCONE_MAPPEDFILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+#if __has_include(<sys/mman.h>)
+#define FIGCONE_MMAP_AVAILABLE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace figcone::detail {
+
+//Maps a regular file read-only into memory.
+//The mapping isn't a snapshot of the file: when the file is truncated while it's mapped, reading the pages past its new
+//end raises SIGBUS and terminates the process. Config files must be replaced by renaming a new file over them (or
+//rewritten in place only when no reads are in progress), which keeps the mapped contents of the old file valid.
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+#ifdef FIGCONE_MMAP_AVAILABLE
+        const auto fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor == -1)
+            return;
+
+        struct stat fileStat = {};
+        if (::fstat(fileDescriptor, &fileStat) == 0 && S_ISREG(fileStat.st_mode)) {
+            size_ = static_cast<std::size_t>(fileStat.st_size);
+            if (size_ == 0)
+                isMapped_ = true;
+            else {
+                auto data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                if (data != MAP_FAILED) {
+                    ::madvise(data, size_, MADV_SEQUENTIAL);
+                    data_ = static_cast<const char*>(data);
+                    isMapped_ = true;
+                }
+            }
+        }
+        ::close(fileDescriptor);
+#else
+        static_cast<void>(path);
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifdef FIGCONE_MMAP_AVAILABLE
+        if (data_)
+            ::munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isMapped() const
+    {
+        return isMapped_;
+    }
+
+    std::string_view data() const
+    {
+        if (!data_)
+            return {};
+        return {data_, size_};
+    }
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool isMapped_ = false;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_MAPPEDFILE_H
\ No newline at end of file
@@ -4,110 +4,198 @@
 #include "external/eel/string_utils.h"
 #include "external/eel/utility.h"
 #include <figcone/nameformat.h>
-#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace figcone::detail {
 
-inline std::string formatName(const std::string& name)
+constexpr bool isAlpha(char ch)
+{
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+constexpr bool isDigit(char ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+constexpr bool isUpper(char ch)
+{
+    return ch >= 'A' && ch <= 'Z';
+}
+
+constexpr char toLower(char ch)
+{
+    return isUpper(ch) ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+constexpr char toUpper(char ch)
+{
+    return (ch >= 'a' && ch <= 'z') ? static_cast<char>(ch - 'a' + 'A') : ch;
+}
+
+constexpr std::string_view formatName(std::string_view name)
 {
-    auto result = name;
     //remove front non-alphabet characters
-    result.erase(
-            result.begin(),
-            std::find_if(
-                    result.begin(),
-                    result.end(),
-                    [](auto ch)
-                    {
-                        return eel::isalpha(ch);
-                    }));
+    while (!name.empty() && !isAlpha(name.front()))
+        name.remove_prefix(1);
     //remove back non-alphabet and non-digit characters
-    result.erase(
-            std::find_if(
-                    result.rbegin(),
-                    result.rend(),
-                    [](auto ch)
-                    {
-                        return eel::isalnum(ch);
-                    })
-                    .base(),
-            result.end());
-    return result;
+    while (!name.empty() && !isAlpha(name.back()) && !isDigit(name.back()))
+        name.remove_suffix(1);
+    return name;
 }
 
-inline std::string toCamelCase(const std::string& name)
+template<typename TString>
+constexpr void writeCamelCase(std::string_view name, TString& result)
 {
-    auto result = std::string{};
     auto prevCharNonAlpha = false;
     auto formattedName = formatName(name);
-    if (!formattedName.empty())
-        formattedName[0] = static_cast<char>(eel::tolower(formattedName[0]));
-    for (auto ch : formattedName) {
-        if (!eel::isalpha(ch)) {
-            if (eel::isdigit(ch))
+    for (auto i = std::size_t{}; i < formattedName.size(); ++i) {
+        auto ch = i == 0 ? toLower(formattedName[i]) : formattedName[i];
+        if (!isAlpha(ch)) {
+            if (isDigit(ch))
                 result.push_back(ch);
             if (!result.empty())
                 prevCharNonAlpha = true;
             continue;
         }
         if (prevCharNonAlpha)
-            ch = static_cast<char>(eel::toupper(ch));
+            ch = toUpper(ch);
         result.push_back(ch);
         prevCharNonAlpha = false;
     }
-    return result;
-}
-
-inline std::string toKebabCase(const std::string& name)
-{
-    auto result = std::string{};
-    auto formattedName = formatName(eel::replace(name, "_", "-"));
-    if (!formattedName.empty())
-        formattedName[0] = eel::tolower(formattedName[0]);
-    for (auto ch : formattedName) {
-        if (eel::isupper(ch) && !result.empty()) {
-            result.push_back('-');
-            result.push_back(eel::tolower(ch));
-        }
-        else
-            result.push_back(ch);
-    }
-    return result;
 }
 
-inline std::string toSnakeCase(const std::string& name)
+template<typename TString>
+constexpr void writeSeparatedCase(std::string_view name, char separator, TString& result)
 {
-    auto result = std::string{};
     auto formattedName = formatName(name);
-    if (!formattedName.empty())
-        formattedName[0] = eel::tolower(formattedName[0]);
-    for (auto ch : formattedName) {
-        if (eel::isupper(ch) && !result.empty()) {
-            result.push_back('_');
-            result.push_back(eel::tolower(ch));
+    for (auto i = std::size_t{}; i < formattedName.size(); ++i) {
+        auto ch = i == 0 ? toLower(formattedName[i]) : formattedName[i];
+        if (ch == '_')
+            ch = separator;
+        if (isUpper(ch) && !result.empty()) {
+            result.push_back(separator);
+            result.push_back(toLower(ch));
         }
         else
             result.push_back(ch);
     }
-    return result;
 }
 
-inline std::string convertName(NameFormat nameFormat, const std::string& configName)
+template<typename TString>
+constexpr void writeConvertedName(NameFormat nameFormat, std::string_view name, TString& result)
 {
     switch (nameFormat) {
     case NameFormat::Original:
-        return formatName(configName);
+        for (auto ch : formatName(name))
+            result.push_back(ch);
+        return;
     case NameFormat::SnakeCase:
-        return toSnakeCase(configName);
+        writeSeparatedCase(name, '_', result);
+        return;
     case NameFormat::CamelCase:
-        return toCamelCase(configName);
+        writeCamelCase(name, result);
+        return;
     case NameFormat::KebabCase:
-        return toKebabCase(configName);
+        writeSeparatedCase(name, '-', result);
+        return;
     }
     eel::unreachable();
 }
 
+inline std::string convertName(NameFormat nameFormat, std::string_view name)
+{
+    auto result = std::string{};
+    writeConvertedName(nameFormat, name, result);
+    return result;
+}
+
+template<std::size_t capacity>
+class StaticString {
+public:
+    constexpr void push_back(char ch)
+    {
+        data_[size_++] = ch;
+    }
+
+    constexpr bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    constexpr std::string_view view() const
+    {
+        return {data_.data(), size_};
+    }
+
+private:
+    std::array<char, capacity> data_{};
+    std::size_t size_ = 0;
+};
+
+template<std::size_t nameSize>
+class ConvertedNames {
+public:
+    constexpr explicit ConvertedNames(std::string_view name)
+    {
+        writeConvertedName(NameFormat::Original, name, original_);
+        writeConvertedName(NameFormat::SnakeCase, name, snakeCase_);
+        writeConvertedName(NameFormat::CamelCase, name, camelCase_);
+        writeConvertedName(NameFormat::KebabCase, name, kebabCase_);
+    }
+
+    constexpr std::string_view get(NameFormat nameFormat) const
+    {
+        switch (nameFormat) {
+        case NameFormat::Original:
+            return original_.view();
+        case NameFormat::SnakeCase:
+            return snakeCase_.view();
+        case NameFormat::CamelCase:
+            return camelCase_.view();
+        case NameFormat::KebabCase:
+            return kebabCase_.view();
+        }
+        eel::unreachable();
+    }
+
+private:
+    StaticString<nameSize * 2> original_;
+    StaticString<nameSize * 2> snakeCase_;
+    StaticString<nameSize * 2> camelCase_;
+    StaticString<nameSize * 2> kebabCase_;
+};
+
+class FieldName {
+public:
+    using ConvertedNameGetter = std::string_view (*)(NameFormat);
+
+    explicit FieldName(std::string_view name, ConvertedNameGetter convertedNameGetter = nullptr)
+        : name_{name}
+        , convertedNameGetter_{convertedNameGetter}
+    {
+    }
+
+    std::string_view name() const
+    {
+        return name_;
+    }
+
+    std::string convertedName(NameFormat nameFormat) const
+    {
+        if (convertedNameGetter_)
+            return std::string{convertedNameGetter_(nameFormat)};
+        return convertName(nameFormat, name_);
+    }
+
+private:
+    std::string_view name_;
+    ConvertedNameGetter convertedNameGetter_;
+};
+
 } //namespace figcone::detail
 
 #endif //FIGCONE_NAMEUTILS_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define FIGCONE_NODE_H
 
 #include "configreaderaccess.h"
+#include "configsnapshot.h"
 #include "iconfigentity.h"
 #include "inode.h"
 #include "utils.h"
@@ -11,6 +12,7 @@
 #include <algorithm>
 #include <sstream>
 #include <string>
+#include <typeinfo>
 
 namespace figcone {
 class Config;
@@ -31,6 +33,7 @@ public:
     void markValueIsSet()
     {
         hasValue_ = true;
+        hasDefaultValue_ = true;
     }
 
 private:
@@ -44,12 +47,29 @@ private:
         if constexpr (is_initialized_optional_v<TCfg> || eel::is_optional_v<TCfg>)
             cfg_.emplace();
 
-        if constexpr (!std::is_base_of_v<figcone::Config, eel::remove_optional_t<TCfg>>) {
-            ConfigReaderAccess{cfgReader_}.loadStructure<eel::remove_optional_t<TCfg>>(maybeOptValue(cfg_));
-        }
+        if (!cfgReader_)
+            return;
 
-        if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.load<TCfg>(node);
+        loadStructure();
+        ConfigReaderAccess{cfgReader_}.reset();
+        ConfigReaderAccess{cfgReader_}.load<TCfg>(node);
+    }
+
+    bool loadChanges(const TreeNode& previousNode, const TreeNode& node) override
+    {
+        //optional nodes are recreated on each load
+        if constexpr (is_initialized_optional_v<TCfg> || eel::is_optional_v<TCfg>)
+            return false;
+        else {
+            if (!cfgReader_ || !node.isItem() || !previousNode.isItem())
+                return false;
+            if constexpr (!std::is_base_of_v<figcone::Config, TCfg>)
+                if (!isStructureLoaded_)
+                    return false;
+
+            position_ = node.position();
+            return ConfigReaderAccess{cfgReader_}.loadChanges(previousNode, node);
+        }
     }
 
     bool hasValue() const override
@@ -60,6 +80,61 @@ private:
             return hasValue_;
     }
 
+    void reset() override
+    {
+        hasValue_ = hasDefaultValue_;
+    }
+
+    bool writeSnapshot(ConfigSnapshotWriter& writer) override
+    {
+        writer.writeField(name_, typeid(TCfg));
+        if constexpr (is_initialized_optional_v<TCfg> || eel::is_optional_v<TCfg>) {
+            writer.writeValue(cfg_.has_value());
+            if (!cfg_.has_value())
+                return true;
+        }
+
+        if (!cfgReader_)
+            return true;
+
+        loadStructure();
+        return ConfigReaderAccess{cfgReader_}.writeSnapshot(writer);
+    }
+
+    void readSnapshot(ConfigSnapshotReader& reader) override
+    {
+        reader.readField(name_, typeid(TCfg));
+        if constexpr (is_initialized_optional_v<TCfg> || eel::is_optional_v<TCfg>) {
+            auto hasValue = false;
+            reader.readValue(hasValue);
+            if (!hasValue) {
+                cfg_.reset();
+                return;
+            }
+            cfg_.emplace();
+        }
+
+        if (!cfgReader_)
+            return;
+
+        loadStructure();
+        ConfigReaderAccess{cfgReader_}.readSnapshot(reader);
+    }
+
+    bool writeSchema(ConfigSnapshotWriter& writer) override
+    {
+        writer.writeField(name_, typeid(TCfg));
+        if (!cfgReader_)
+            return true;
+
+        //the fields of optional nodes are stored with their default values too
+        if constexpr (is_initialized_optional_v<TCfg> || eel::is_optional_v<TCfg>)
+            if (!cfg_.has_value())
+                cfg_.emplace();
+        loadStructure();
+        return ConfigReaderAccess{cfgReader_}.writeSchema(writer);
+    }
+
     StreamPosition position() override
     {
         return position_;
@@ -70,11 +145,23 @@ private:
         return "Node '" + name_ + "'";
     }
 
+    void loadStructure()
+    {
+        if constexpr (!std::is_base_of_v<figcone::Config, eel::remove_optional_t<TCfg>>) {
+            if (!isStructureLoaded_) {
+                ConfigReaderAccess{cfgReader_}.loadStructure<eel::remove_optional_t<TCfg>>(maybeOptValue(cfg_));
+                isStructureLoaded_ = true;
+            }
+        }
+    }
+
 private:
     std::string name_;
     TCfg& cfg_;
     ConfigReaderPtr cfgReader_;
     bool hasValue_ = false;
+    bool hasDefaultValue_ = false;
+    bool isStructureLoaded_ = false;
     StreamPosition position_;
 };
 
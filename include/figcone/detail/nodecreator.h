@@ -4,6 +4,7 @@
 #include "configreaderaccess.h"
 #include "creatormode.h"
 #include "inode.h"
+#include "nameutils.h"
 #include "node.h"
 #include "utils.h"
 #include "validator.h"
@@ -11,6 +12,7 @@
 #include "external/eel/type_traits.h"
 #include "external/eel/utility.h"
 #include <figcone/nameformat.h>
+#include <string>
 #include <type_traits>
 
 namespace figcone {
@@ -35,32 +37,35 @@ class NodeCreator {
             "TConfig must not inherit from figcone::Config when static reflection interface is used.");
 
 public:
-    NodeCreator(ConfigReaderPtr cfgReader, std::string nodeName, TCfg& nodeCfg, bool isOptional = false)
+    NodeCreator(ConfigReaderPtr cfgReader, FieldName nodeName, TCfg& nodeCfg, bool isOptional = false)
         : cfgReader_{cfgReader}
-        , nodeName_{(eel::precondition(!nodeName.empty(), FIGCONE_EEL_LINE), std::move(nodeName))}
+        , nodeName_{(eel::precondition(!nodeName.name().empty(), FIGCONE_EEL_LINE), nodeName)}
         , nodeCfg_{nodeCfg}
-        , nestedCfgReader_{cfgReader_ ? ConfigReaderAccess{cfgReader_}.makeNestedReader(nodeName_) : ConfigReaderPtr{}}
+        , nestedCfgReader_{
+                  cfgReader_ ? ConfigReaderAccess{cfgReader_}.makeNestedReader(nodeName_.name()) : ConfigReaderPtr{}}
     {
         if constexpr (std::is_base_of_v<figcone::Config, TCfg> && eel::is_optional_v<TCfg>)
             static_assert(
                     eel::dependent_false<TCfg>,
                     "TConfig can't be placed in std::optional, use figcone::optional instead.");
-        node_ = std::make_unique<Node<TCfg>>(nodeName_, nodeCfg_, nestedCfgReader_);
+        if (cfgReader_)
+            node_ = std::make_unique<Node<TCfg>>(std::string{nodeName_.name()}, nodeCfg_, nestedCfgReader_);
 
-        if (isOptional)
+        if (isOptional && node_)
             node_->markValueIsSet();
     }
 
     NodeCreator& operator()()
     {
-        node_->markValueIsSet();
+        if (node_)
+            node_->markValueIsSet();
         return *this;
     }
 
     void createNode()
     {
         if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addNode(nodeName_, std::move(node_));
+            ConfigReaderAccess{cfgReader_}.addNode(nodeName_, std::move(node_), &nodeCfg_);
     }
 
     operator TCfg()
@@ -95,7 +100,7 @@ public:
 
 private:
     ConfigReaderPtr cfgReader_;
-    std::string nodeName_;
+    FieldName nodeName_;
     TCfg& nodeCfg_;
     ConfigReaderPtr nestedCfgReader_;
     std::unique_ptr<Node<TCfg>> node_;
@@ -2,14 +2,18 @@
 #define FIGCONE_NODELIST_H
 
 #include "configreaderaccess.h"
+#include "configsnapshot.h"
 #include "inode.h"
 #include "loadingerror.h"
+#include "parallelfor.h"
 #include "utils.h"
 #include "external/eel/type_traits.h"
 #include <figcone/errors.h>
 #include <figcone_tree/tree.h>
+#include <cstddef>
 #include <memory>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 namespace figcone::detail {
@@ -21,6 +25,8 @@ enum class NodeListType {
 
 template<typename TCfgList>
 class NodeList : public detail::INode {
+    using Cfg = typename eel::remove_optional_t<TCfgList>::value_type;
+
 public:
     NodeList(std::string name, TCfgList& nodeList, ConfigReaderPtr cfgReader, NodeListType type = NodeListType::Normal)
         : name_{std::move(name)}
@@ -36,6 +42,7 @@ public:
     void markValueIsSet()
     {
         hasValue_ = true;
+        hasDefaultValue_ = true;
     }
 
     void load(const TreeNode& nodeList) override
@@ -49,41 +56,41 @@ public:
             nodeList_.emplace();
 
         maybeOptValue(nodeList_).clear();
-        for (auto i = 0; i < nodeList.asList().size(); ++i) {
-            const auto& treeNode = nodeList.asList().at(i);
-            try {
-                using Cfg = typename eel::remove_optional_t<TCfgList>::value_type;
-                if constexpr (std::is_base_of_v<figcone::Config, Cfg>) {
-                    if constexpr (!std::is_aggregate_v<Cfg>)
-                        static_assert(
-                                std::is_constructible_v<Cfg, detail::ConfigReaderPtr>,
-                                "Non aggregate config objects must inherit figcone::Config constructors with 'using "
-                                "Config::Config;'");
-
-                    auto cfg = Cfg{cfgReader_};
-                    if (cfgReader_) {
-                        if (type_ == NodeListType::Copy && i > 0)
-                            ConfigReaderAccess{cfgReader_}.load<Cfg>(nodeList.asList().at(0));
-                        ConfigReaderAccess{cfgReader_}.load<Cfg>(treeNode);
-                    }
-                    maybeOptValue(nodeList_).emplace_back(std::move(cfg));
-                }
-                else {
-                    auto cfg = Cfg{};
-                    if (cfgReader_) {
-                        ConfigReaderAccess{cfgReader_}.loadStructure<Cfg>(cfg);
-
-                        if (type_ == NodeListType::Copy && i > 0)
-                            ConfigReaderAccess{cfgReader_}.load<Cfg>(nodeList.asList().at(0));
-                        ConfigReaderAccess{cfgReader_}.load<Cfg>(treeNode);
-                    }
-                    maybeOptValue(nodeList_).emplace_back(std::move(cfg));
-                }
-            }
-            catch (const LoadingError& e) {
-                throw ConfigError{"Node list '" + name_ + "': " + e.what(), treeNode.position()};
-            }
-        }
+        if constexpr (std::is_base_of_v<figcone::Config, Cfg> && !std::is_aggregate_v<Cfg>)
+            static_assert(
+                    std::is_constructible_v<Cfg, detail::ConfigReaderPtr>,
+                    "Non aggregate config objects must inherit figcone::Config constructors with 'using "
+                    "Config::Config;'");
+
+        const auto size = static_cast<std::size_t>(nodeList.asList().size());
+        const auto workerCount = detail::workerCount(ConfigReaderAccess{cfgReader_}.nodeListParallelism(), size);
+
+        auto schemas = std::vector<decltype(ConfigReaderAccess{cfgReader_}.template acquireSchema<Cfg>())>{};
+        schemas.reserve(workerCount);
+        for (auto i = std::size_t{}; i < workerCount; ++i)
+            schemas.emplace_back(ConfigReaderAccess{cfgReader_}.template acquireSchema<Cfg>());
+
+        auto elements = std::vector<Cfg>(size);
+        parallelFor(
+                size,
+                workerCount,
+                [&](std::size_t index, std::size_t workerIndex)
+                {
+                    const auto& element = nodeList.asList().at(static_cast<int>(index));
+                    const auto& firstElement = nodeList.asList().at(0);
+                    elements[index] = readElement(*schemas[workerIndex], element, firstElement);
+                });
+
+        if constexpr (std::is_same_v<eel::remove_optional_t<TCfgList>, std::vector<Cfg>>)
+            maybeOptValue(nodeList_) = std::move(elements);
+        else
+            for (auto& element : elements)
+                maybeOptValue(nodeList_).emplace_back(std::move(element));
+    }
+
+    bool loadChanges(const TreeNode&, const TreeNode&) override
+    {
+        return false;
     }
 
     bool hasValue() const override
@@ -94,6 +101,68 @@ public:
             return hasValue_;
     }
 
+    void reset() override
+    {
+        hasValue_ = hasDefaultValue_;
+    }
+
+    bool writeSnapshot(ConfigSnapshotWriter& writer) override
+    {
+        writer.writeField(name_, typeid(TCfgList));
+        if constexpr (eel::is_optional_v<TCfgList>) {
+            writer.writeValue(nodeList_.has_value());
+            if (!nodeList_.has_value())
+                return true;
+        }
+
+        writer.writeCount(maybeOptValue(nodeList_).size());
+        auto schema = ConfigReaderAccess{cfgReader_}.template acquireSchema<Cfg>();
+        for (auto& element : maybeOptValue(nodeList_)) {
+            auto& cfg = schema->cfg();
+            cfg = std::move(element);
+            const auto isWritten = ConfigReaderAccess{&schema->reader()}.writeSnapshot(writer);
+            element = std::move(cfg);
+            if (!isWritten)
+                return false;
+        }
+        return true;
+    }
+
+    void readSnapshot(ConfigSnapshotReader& reader) override
+    {
+        reader.readField(name_, typeid(TCfgList));
+        nodeList_ = TCfgList{};
+        if constexpr (eel::is_optional_v<TCfgList>) {
+            auto hasValue = false;
+            reader.readValue(hasValue);
+            if (!hasValue)
+                return;
+            nodeList_.emplace();
+        }
+
+        const auto size = reader.readCount();
+        auto schema = ConfigReaderAccess{cfgReader_}.template acquireSchema<Cfg>();
+        for (auto i = std::size_t{}; i < size; ++i) {
+            auto& cfg = schema->cfg();
+            cfg = Cfg{};
+            ConfigReaderAccess{&schema->reader()}.readSnapshot(reader);
+            maybeOptValue(nodeList_).emplace_back(std::move(cfg));
+        }
+    }
+
+    bool writeSchema(ConfigSnapshotWriter& writer) override
+    {
+        if (!writeSnapshot(writer))
+            return false;
+        //the schema of the elements is stored once, so node lists of their own config type are supported
+        if (!writer.addSchemaType(typeid(Cfg)))
+            return true;
+
+        auto schema = ConfigReaderAccess{cfgReader_}.template acquireSchema<Cfg>();
+        schema->cfg() = Cfg{};
+        return ConfigReaderAccess{&schema->reader()}.writeSchema(writer);
+    }
+
     StreamPosition position() override
     {
         return position_;
@@ -104,10 +173,30 @@ public:
         return "Node list '" + name_ + "'";
     }
 
+private:
+    template<typename TSchema>
+    Cfg readElement(TSchema& schema, const TreeNode& treeNode, const TreeNode& firstTreeNode)
+    {
+        auto& cfg = schema.cfg();
+        auto reader = ConfigReaderAccess{&schema.reader()};
+        try {
+            cfg = Cfg{};
+            reader.reset();
+            if (type_ == NodeListType::Copy && &treeNode != &firstTreeNode)
+                reader.template load<Cfg>(firstTreeNode);
+            reader.template load<Cfg>(treeNode);
+        }
+        catch (const LoadingError& e) {
+            throw ConfigError{"Node list '" + name_ + "': " + e.what(), treeNode.position()};
+        }
+        return std::move(cfg);
+    }
+
 private:
     std::string name_;
     TCfgList& nodeList_;
     bool hasValue_ = false;
+    bool hasDefaultValue_ = false;
     StreamPosition position_;
     NodeListType type_;
     ConfigReaderPtr cfgReader_;
@@ -3,10 +3,12 @@
 
 #include "configreaderaccess.h"
 #include "creatormode.h"
+#include "nameutils.h"
 #include "nodelist.h"
 #include "external/eel/contract.h"
 #include "external/eel/type_traits.h"
 #include <figcone/nameformat.h>
+#include <string>
 
 namespace figcone {
 class Config;
@@ -35,33 +37,36 @@ class NodeListCreator {
 public:
     NodeListCreator(
             ConfigReaderPtr cfgReader,
-            std::string nodeListName,
+            FieldName nodeListName,
             TCfgList& nodeList,
             NodeListType type = NodeListType::Normal,
             bool isOptional = false)
         : cfgReader_{cfgReader}
-        , nodeListName_{(eel::precondition(!nodeListName.empty(), FIGCONE_EEL_LINE), std::move(nodeListName))}
-        , nodeList_{std::make_unique<NodeList<TCfgList>>(
-                  nodeListName_,
-                  nodeList,
-                  cfgReader_ ? ConfigReaderAccess{cfgReader_}.makeNestedReader(nodeListName_) : ConfigReaderPtr{},
-                  type)}
+        , nodeListName_{(eel::precondition(!nodeListName.name().empty(), FIGCONE_EEL_LINE), nodeListName)}
+        , nodeList_{
+                  cfgReader_ ? std::make_unique<NodeList<TCfgList>>(
+                                       std::string{nodeListName_.name()},
+                                       nodeList,
+                                       ConfigReaderAccess{cfgReader_}.makeNodeListReader(nodeListName_.name()),
+                                       type)
+                             : nullptr}
         , nodeListValue_(nodeList)
     {
-        if (isOptional)
+        if (isOptional && nodeList_)
             nodeList_->markValueIsSet();
     }
 
     NodeListCreator& operator()()
     {
-        nodeList_->markValueIsSet();
+        if (nodeList_)
+            nodeList_->markValueIsSet();
         return *this;
     }
 
     void createNodeList()
     {
         if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addNode(nodeListName_, std::move(nodeList_));
+            ConfigReaderAccess{cfgReader_}.addNode(nodeListName_, std::move(nodeList_), &nodeListValue_);
     }
 
     operator TCfgList()
@@ -91,7 +96,7 @@ public:
 
 private:
     ConfigReaderPtr cfgReader_;
-    std::string nodeListName_;
+    FieldName nodeListName_;
     std::unique_ptr<NodeList<TCfgList>> nodeList_;
     TCfgList& nodeListValue_;
 };
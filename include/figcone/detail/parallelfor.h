@@ -0,0 +1,126 @@
+#ifndef FIGCONE_PARALLELFOR_H
+#define FIGCONE_PARALLELFOR_H
+
+#include "workerpool.h"
+#include <figcone/nodelistparallelism.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace figcone::detail {
+
+//Returns the number of workers for processing size items on threadCount threads (0 - use
+//std::thread::hardware_concurrency()). Parallel loads started from a worker run sequentially.
+inline std::size_t workerCount(int threadCount, std::size_t size)
+{
+    if (threadCount == 1 || WorkerPool::isWorkerThread())
+        return 1;
+
+    const auto maxWorkerCount = threadCount > 0 ? static_cast<std::size_t>(threadCount)
+                                                : std::max(std::thread::hardware_concurrency(), 1u);
+    return std::max(std::min(maxWorkerCount, size), std::size_t{1});
+}
+
+inline std::size_t workerCount(const NodeListParallelism& parallelism, std::size_t size)
+{
+    if (size < parallelism.minNodeListSize)
+        return 1;
+    return workerCount(parallelism.threadCount, size);
+}
+
+//Calls runWorker(workerIndex) for every worker on the shared worker pool, the first worker runs on the calling thread
+template<typename TFunc>
+void runWorkers(std::size_t workerCount, const TFunc& runWorker)
+{
+    WorkerPool::instance().run(workerCount, runWorker);
+}
+
+inline void storeMin(std::atomic<std::size_t>& value, std::size_t newValue)
+{
+    auto currentValue = value.load();
+    while (newValue < currentValue && !value.compare_exchange_weak(currentValue, newValue)) {
+    }
+}
+
+//Calls func(index, workerIndex) for every index in [0, size), each worker processes a contiguous range of indices.
+//If calls throw, the exception from the lowest index is rethrown, the same as with a sequential loop.
+template<typename TFunc>
+void parallelFor(std::size_t size, std::size_t workerCount, const TFunc& func)
+{
+    if (workerCount <= 1) {
+        for (auto i = std::size_t{}; i < size; ++i)
+            func(i, std::size_t{});
+        return;
+    }
+
+    auto errors = std::vector<std::exception_ptr>(workerCount);
+    auto firstFailedWorker = std::atomic<std::size_t>{workerCount};
+    runWorkers(
+            workerCount,
+            [&](std::size_t workerIndex)
+            {
+                const auto begin = size * workerIndex / workerCount;
+                const auto end = size * (workerIndex + 1) / workerCount;
+                try {
+                    for (auto i = begin; i < end && firstFailedWorker.load() > workerIndex; ++i)
+                        func(i, workerIndex);
+                }
+                catch (...) {
+                    errors[workerIndex] = std::current_exception();
+                    storeMin(firstFailedWorker, workerIndex);
+                }
+            });
+
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+
+//Calls func(index, workerIndex) for every index in [0, size), workers take the next index after finishing the previous
+//one, which balances the load when calls take a different amount of time.
+//If calls throw, the exception from the lowest index is rethrown, the same as with a sequential loop.
+template<typename TFunc>
+void parallelForDynamic(std::size_t size, std::size_t workerCount, const TFunc& func)
+{
+    if (workerCount <= 1) {
+        parallelFor(size, workerCount, func);
+        return;
+    }
+
+    auto errors = std::vector<std::pair<std::size_t, std::exception_ptr>>(workerCount);
+    auto nextIndex = std::atomic<std::size_t>{};
+    auto firstFailedIndex = std::atomic<std::size_t>{size};
+    runWorkers(
+            workerCount,
+            [&](std::size_t workerIndex)
+            {
+                for (auto i = nextIndex++; i < size && i < firstFailedIndex.load(); i = nextIndex++) {
+                    try {
+                        func(i, workerIndex);
+                    }
+                    catch (...) {
+                        errors[workerIndex] = {i, std::current_exception()};
+                        storeMin(firstFailedIndex, i);
+                        return;
+                    }
+                }
+            });
+
+    const auto firstError = std::min_element(
+            errors.begin(),
+            errors.end(),
+            [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.second && (!rhs.second || lhs.first < rhs.first);
+            });
+    if (firstError->second)
+        std::rethrow_exception(firstError->second);
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_PARALLELFOR_H
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef FIGCONE_PARAM_H
 #define FIGCONE_PARAM_H
 
+#include "configsnapshot.h"
 #include "iconfigentity.h"
 #include "iparam.h"
 #include "stringconverter.h"
@@ -13,6 +14,7 @@
 #include <algorithm>
 #include <sstream>
 #include <string>
+#include <typeinfo>
 
 namespace figcone::detail {
 
@@ -28,6 +30,7 @@ public:
     void markValueIsSet()
     {
         hasValue_ = true;
+        hasDefaultValue_ = true;
     }
 
 private:
@@ -39,9 +42,9 @@ private:
             throw ConfigError{"Parameter '" + name_ + "': config parameter can't be a list.", param.position()};
         auto paramReadResult = convertFromString<T>(param.value());
         auto readResultVisitor = eel::overloaded{
-                [&](const T& param)
+                [&](T& param)
                 {
-                    paramValue_ = param;
+                    paramValue_ = std::move(param);
                 },
                 [&](const StringConversionError& error)
                 {
@@ -54,6 +57,11 @@ private:
         std::visit(readResultVisitor, paramReadResult);
     }
 
+    bool isList() const override
+    {
+        return false;
+    }
+
     bool hasValue() const override
     {
         if constexpr (eel::is_optional_v<T>)
@@ -62,6 +70,32 @@ private:
             return hasValue_;
     }
 
+    void reset() override
+    {
+        hasValue_ = hasDefaultValue_;
+    }
+
+    bool writeSnapshot(ConfigSnapshotWriter& writer) override
+    {
+        if constexpr (isSnapshotValue<T>()) {
+            writer.writeField(name_, typeid(T));
+            writer.writeValue(paramValue_);
+            return true;
+        }
+        else
+            return false;
+    }
+
+    void readSnapshot(ConfigSnapshotReader& reader) override
+    {
+        if constexpr (isSnapshotValue<T>()) {
+            reader.readField(name_, typeid(T));
+            reader.readValue(paramValue_);
+        }
+        else
+            throw ConfigSnapshotReader::ReadError{};
+    }
+
     StreamPosition position() override
     {
         return position_;
@@ -76,6 +110,7 @@ private:
     std::string name_;
     T& paramValue_;
     bool hasValue_ = false;
+    bool hasDefaultValue_ = false;
     StreamPosition position_;
 };
 
@@ -2,29 +2,32 @@
 #define FIGCONE_PARAMCREATOR_H
 
 #include "configreaderaccess.h"
+#include "nameutils.h"
 #include "param.h"
 #include "validator.h"
 #include "external/eel/contract.h"
+#include <string>
 
 namespace figcone::detail {
 
 template<typename T>
 class ParamCreator {
 public:
-    ParamCreator(ConfigReaderPtr cfgReader, std::string paramName, T& paramValue, bool isOptional = false)
+    ParamCreator(ConfigReaderPtr cfgReader, FieldName paramName, T& paramValue, bool isOptional = false)
         : cfgReader_{cfgReader}
-        , paramName_{(eel::precondition(!paramName.empty(), FIGCONE_EEL_LINE), std::move(paramName))}
+        , paramName_{(eel::precondition(!paramName.name().empty(), FIGCONE_EEL_LINE), paramName)}
         , paramValue_{paramValue}
-        , param_{std::make_unique<Param<T>>(paramName_, paramValue)}
+        , param_{cfgReader_ ? std::make_unique<Param<T>>(std::string{paramName_.name()}, paramValue) : nullptr}
     {
-        if (isOptional)
+        if (isOptional && param_)
             param_->markValueIsSet();
     }
 
     ParamCreator<T>& operator()(T defaultValue = {})
     {
         defaultValue_ = std::move(defaultValue);
-        param_->markValueIsSet();
+        if (param_)
+            param_->markValueIsSet();
         return *this;
     }
 
@@ -48,7 +51,7 @@ public:
     void createParam()
     {
         if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addParam(paramName_, std::move(param_));
+            ConfigReaderAccess{cfgReader_}.addParam(paramName_, std::move(param_), &paramValue_);
     }
 
     operator T()
@@ -59,7 +62,7 @@ public:
 
 private:
     ConfigReaderPtr cfgReader_;
-    std::string paramName_;
+    FieldName paramName_;
     T& paramValue_;
     std::unique_ptr<Param<T>> param_;
     T defaultValue_;
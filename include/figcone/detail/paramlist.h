@@ -1,6 +1,7 @@
 #ifndef FIGCONE_PARAMLIST_H
 #define FIGCONE_PARAMLIST_H
 
+#include "configsnapshot.h"
 #include "iparam.h"
 #include "stringconverter.h"
 #include "utils.h"
@@ -11,6 +12,7 @@
 #include <algorithm>
 #include <sstream>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace figcone::detail {
@@ -31,6 +33,7 @@ public:
     void markValueIsSet()
     {
         hasValue_ = true;
+        hasDefaultValue_ = true;
     }
 
 private:
@@ -48,9 +51,9 @@ private:
             using Param = typename eel::remove_optional_t<TParamList>::value_type;
             auto paramReadResult = convertFromString<Param>(paramValueStr);
             auto readResultVisitor = eel::overloaded{
-                    [&](const Param& param)
+                    [&](Param& param)
                     {
-                        maybeOptValue(paramListValue_).emplace_back(param);
+                        maybeOptValue(paramListValue_).emplace_back(std::move(param));
                     },
                     [&](const StringConversionError& error)
                     {
@@ -64,6 +67,11 @@ private:
         }
     }
 
+    bool isList() const override
+    {
+        return true;
+    }
+
     bool hasValue() const override
     {
         if constexpr (eel::is_optional_v<TParamList>)
@@ -72,6 +80,32 @@ private:
             return hasValue_;
     }
 
+    void reset() override
+    {
+        hasValue_ = hasDefaultValue_;
+    }
+
+    bool writeSnapshot(ConfigSnapshotWriter& writer) override
+    {
+        if constexpr (isSnapshotValue<TParamList>()) {
+            writer.writeField(name_, typeid(TParamList));
+            writer.writeValue(paramListValue_);
+            return true;
+        }
+        else
+            return false;
+    }
+
+    void readSnapshot(ConfigSnapshotReader& reader) override
+    {
+        if constexpr (isSnapshotValue<TParamList>()) {
+            reader.readField(name_, typeid(TParamList));
+            reader.readValue(paramListValue_);
+        }
+        else
+            throw ConfigSnapshotReader::ReadError{};
+    }
+
     StreamPosition position() override
     {
         return position_;
@@ -86,6 +120,7 @@ private:
     std::string name_;
     TParamList& paramListValue_;
     bool hasValue_ = false;
+    bool hasDefaultValue_ = false;
     StreamPosition position_;
 };
 
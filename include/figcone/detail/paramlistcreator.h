@@ -3,11 +3,13 @@
 
 #include "configreaderaccess.h"
 #include "inode.h"
+#include "nameutils.h"
 #include "paramlist.h"
 #include "utils.h"
 #include "validator.h"
 #include "external/eel/contract.h"
 #include "external/eel/type_traits.h"
+#include <string>
 #include <vector>
 
 namespace figcone::detail {
@@ -21,22 +23,27 @@ class ParamListCreator {
 public:
     ParamListCreator(
             ConfigReaderPtr cfgReader,
-            std::string paramListName,
+            FieldName paramListName,
             TParamList& paramListValue,
             bool isOptional = false)
         : cfgReader_{cfgReader}
-        , paramListName_{(eel::precondition(!paramListName.empty(), FIGCONE_EEL_LINE), std::move(paramListName))}
+        , paramListName_{(eel::precondition(!paramListName.name().empty(), FIGCONE_EEL_LINE), paramListName)}
         , paramListValue_{paramListValue}
-        , paramList_{std::make_unique<ParamList<TParamList>>(paramListName_, paramListValue)}
+        , paramList_{
+                  cfgReader_ ? std::make_unique<ParamList<TParamList>>(
+                                       std::string{paramListName_.name()},
+                                       paramListValue)
+                             : nullptr}
     {
-        if (isOptional)
+        if (isOptional && paramList_)
             paramList_->markValueIsSet();
     }
 
     ParamListCreator<TParamList>& operator()(TParamList defaultValue = {})
     {
         defaultValue_ = std::move(defaultValue);
-        paramList_->markValueIsSet();
+        if (paramList_)
+            paramList_->markValueIsSet();
         return *this;
     }
 
@@ -62,7 +69,7 @@ public:
     void createParamList()
     {
         if (cfgReader_)
-            ConfigReaderAccess{cfgReader_}.addParam(paramListName_, std::move(paramList_));
+            ConfigReaderAccess{cfgReader_}.addParam(paramListName_, std::move(paramList_), &paramListValue_);
     }
 
     operator TParamList()
@@ -73,7 +80,7 @@ public:
 
 private:
     ConfigReaderPtr cfgReader_;
-    std::string paramListName_;
+    FieldName paramListName_;
     TParamList& paramListValue_;
     std::unique_ptr<ParamList<TParamList>> paramList_;
     TParamList defaultValue_;
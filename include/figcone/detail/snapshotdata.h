@@ -0,0 +1,223 @@
+#ifndef FIGCONE_SNAPSHOTDATA_H
+#define FIGCONE_SNAPSHOTDATA_H
+
+#include "mappedfile.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace figcone::detail {
+
+//Identifies the config content a snapshot was made for
+struct SnapshotKey {
+    std::uint64_t contentSize = 0;
+    std::uint64_t contentHash = 0;
+    std::uint64_t parserHash = 0;
+};
+
+//64-bit FNV-1a applied to 8-byte words, it isn't meant to resist deliberate collisions
+inline std::uint64_t snapshotHash(std::string_view data)
+{
+    constexpr auto prime = std::uint64_t{1099511628211ull};
+    auto hash = std::uint64_t{14695981039346656037ull};
+    auto pos = std::size_t{};
+    for (; pos + sizeof(std::uint64_t) <= data.size(); pos += sizeof(std::uint64_t)) {
+        auto word = std::uint64_t{};
+        std::memcpy(&word, data.data() + pos, sizeof(word));
+        hash = (hash ^ word) * prime;
+        hash ^= hash >> 29;
+    }
+    for (; pos < data.size(); ++pos)
+        hash = (hash ^ static_cast<unsigned char>(data[pos])) * prime;
+    return hash;
+}
+
+inline SnapshotKey makeSnapshotKey(std::string_view configContent, std::string_view parserName)
+{
+    return {configContent.size(), snapshotHash(configContent), snapshotHash(parserName)};
+}
+
+//Snapshot layout: magic, key, content, checksum of everything before it.
+//Integers are stored as LEB128 varints.
+class SnapshotDataWriter {
+public:
+    void writeInt(std::uint64_t value)
+    {
+        while (value >= 0x80) {
+            data_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        data_.push_back(static_cast<char>(value));
+    }
+
+    void writeString(std::string_view value)
+    {
+        writeInt(value.size());
+        data_.append(value);
+    }
+
+    void writeBytes(std::string_view bytes)
+    {
+        data_.append(bytes);
+    }
+
+    void writeHeader(std::string_view magic, const SnapshotKey& key)
+    {
+        writeBytes(magic);
+        writeInt(key.contentSize);
+        writeInt(key.contentHash);
+        writeInt(key.parserHash);
+    }
+
+    const std::string& data() const
+    {
+        return data_;
+    }
+
+    std::string finish() &&
+    {
+        const auto checksum = snapshotHash(data_);
+        for (auto i = std::size_t{}; i < checksumSize; ++i)
+            data_.push_back(static_cast<char>((checksum >> (i * 8)) & 0xFF));
+        return std::move(data_);
+    }
+
+    static constexpr auto checksumSize = sizeof(std::uint64_t);
+
+private:
+    std::string data_;
+};
+
+class SnapshotDataReader {
+public:
+    struct ReadError : std::exception {};
+
+    //reads data without a header and a checksum
+    explicit SnapshotDataReader(std::string_view data)
+        : data_{data}
+    {
+    }
+
+    //returns std::nullopt if the snapshot is damaged or was made for another snapshot format or config content
+    static std::optional<SnapshotDataReader> open(
+            std::string_view snapshot,
+            std::string_view magic,
+            const SnapshotKey& key)
+    {
+        if (snapshot.size() < SnapshotDataWriter::checksumSize)
+            return std::nullopt;
+        const auto data = snapshot.substr(0, snapshot.size() - SnapshotDataWriter::checksumSize);
+        if (data.substr(0, magic.size()) != magic)
+            return std::nullopt;
+        auto checksum = std::uint64_t{};
+        for (auto i = std::size_t{}; i < SnapshotDataWriter::checksumSize; ++i)
+            checksum |= static_cast<std::uint64_t>(static_cast<unsigned char>(snapshot[data.size() + i])) << (i * 8);
+        if (checksum != snapshotHash(data))
+            return std::nullopt;
+
+        auto reader = SnapshotDataReader{data.substr(magic.size())};
+        try {
+            if (reader.readInt() != key.contentSize || reader.readInt() != key.contentHash ||
+                reader.readInt() != key.parserHash)
+                return std::nullopt;
+        }
+        catch (const ReadError&) {
+            return std::nullopt;
+        }
+        return reader;
+    }
+
+    std::string_view readBytes(std::size_t size)
+    {
+        if (size > data_.size())
+            throw ReadError{};
+        auto result = data_.substr(0, size);
+        data_.remove_prefix(size);
+        return result;
+    }
+
+    std::uint64_t readInt()
+    {
+        auto value = std::uint64_t{};
+        for (auto shift = 0; shift < 64; shift += 7) {
+            if (data_.empty())
+                throw ReadError{};
+            const auto byte = static_cast<unsigned char>(data_.front());
+            data_.remove_prefix(1);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        throw ReadError{};
+    }
+
+    std::size_t readCount()
+    {
+        const auto count = readInt();
+        //each counted entry takes at least one byte
+        if (count > data_.size())
+            throw ReadError{};
+        return static_cast<std::size_t>(count);
+    }
+
+    std::string readString()
+    {
+        return std::string{readBytes(readCount())};
+    }
+
+    bool isFinished() const
+    {
+        return data_.empty();
+    }
+
+private:
+    std::string_view data_;
+};
+
+//failing to save a snapshot isn't an error, the config is parsed again on the next read
+inline void writeSnapshotFile(const std::filesystem::path& snapshotFile, std::string_view snapshot)
+{
+    auto tmpSnapshotFile = snapshotFile;
+    tmpSnapshotFile += ".tmp";
+    {
+        auto snapshotStream = std::ofstream{tmpSnapshotFile, std::ios_base::binary | std::ios_base::trunc};
+        snapshotStream.write(snapshot.data(), static_cast<std::streamsize>(snapshot.size()));
+        if (!snapshotStream.flush())
+            return;
+    }
+    auto error = std::error_code{};
+    std::filesystem::rename(tmpSnapshotFile, snapshotFile, error);
+    if (error)
+        std::filesystem::remove(tmpSnapshotFile, error);
+}
+
+//calls readSnapshot with the content of snapshotFile, returns an empty result if the file can't be read
+template<typename TReadSnapshot>
+auto readSnapshotFile(const std::filesystem::path& snapshotFile, const TReadSnapshot& readSnapshot)
+        -> decltype(readSnapshot(std::string_view{}))
+{
+    auto mappedFile = MappedFile{snapshotFile};
+    if (mappedFile.isMapped())
+        return readSnapshot(mappedFile.data());
+
+    auto snapshotStream = std::ifstream{snapshotFile, std::ios_base::binary | std::ios_base::ate};
+    if (!snapshotStream.is_open())
+        return {};
+    auto snapshot = std::string(static_cast<std::size_t>(snapshotStream.tellg()), '\0');
+    snapshotStream.seekg(0);
+    if (!snapshotStream.read(snapshot.data(), static_cast<std::streamsize>(snapshot.size())))
+        return {};
+    return readSnapshot(std::string_view{snapshot});
+}
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_SNAPSHOTDATA_H
\ No newline at end of file
@@ -4,7 +4,13 @@
 #include <figcone/detail/external/eel/type_traits.h>
 #include <figcone_tree/errors.h>
 #include <figcone_tree/stringconverter.h>
+#include <charconv>
+#include <cmath>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <variant>
 
 namespace figcone::detail {
@@ -14,11 +20,56 @@ struct StringConversionError {
 };
 
 template<typename T>
-std::optional<T> fromString(const std::string& data)
+inline constexpr auto is_character_v = std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+        std::is_same_v<T, unsigned char> || std::is_same_v<T, wchar_t> || std::is_same_v<T, char16_t> ||
+        std::is_same_v<T, char32_t>
+#ifdef __cpp_char8_t
+        || std::is_same_v<T, char8_t>
+#endif
+        ;
+
+template<typename T>
+inline constexpr auto is_from_chars_convertible_v =
+#ifdef __cpp_lib_to_chars
+        std::is_floating_point_v<T> ||
+#endif
+        (std::is_integral_v<T> && !std::is_same_v<T, bool> && !is_character_v<T>);
+
+//empty result means that the value must be read with stringstream to keep its parsing rules
+template<typename T>
+std::optional<T> fromChars(std::string_view data)
+{
+    auto value = T{};
+    const auto dataEnd = data.data() + data.size();
+    const auto [end, error] = std::from_chars(data.data(), dataEnd, value);
+    if (error != std::errc{} || end != dataEnd)
+        return std::nullopt;
+    if constexpr (std::is_floating_point_v<T>)
+        if (!std::isfinite(value))
+            return std::nullopt;
+    return value;
+}
+
+template<typename T>
+std::optional<T> fromString(std::string_view data)
 {
-    [[maybe_unused]] auto setValue = [](auto& value, const std::string& data) -> std::optional<T>
+    [[maybe_unused]] auto setValue = [](auto& value, std::string_view data) -> std::optional<T>
     {
-        auto stream = std::stringstream{data};
+        using ValueType = std::decay_t<decltype(value)>;
+        if constexpr (is_from_chars_convertible_v<ValueType>) {
+            if (auto result = fromChars<ValueType>(data)) {
+                value = *result;
+                return value;
+            }
+        }
+        else if constexpr (std::is_same_v<ValueType, bool>) {
+            if (data == "0" || data == "1") {
+                value = data == "1";
+                return value;
+            }
+        }
+
+        auto stream = std::stringstream{std::string{data}};
         stream >> value;
 
         if (stream.bad() || stream.fail() || !stream.eof())
@@ -27,7 +78,7 @@ std::optional<T> fromString(const std::string& data)
     };
 
     if constexpr (std::is_convertible_v<std::string, tree::eel::remove_optional_t<T>>) {
-        return data;
+        return std::string{data};
     }
     else if constexpr (tree::eel::is_optional_v<T>) {
         auto value = T{};
@@ -40,14 +91,26 @@ std::optional<T> fromString(const std::string& data)
     }
 }
 
+template<typename T, typename = void>
+struct has_string_view_converter : std::false_type {};
+
+template<typename T>
+struct has_string_view_converter<
+        T,
+        std::void_t<decltype(StringConverter<T>::fromString(std::declval<std::string_view>()))>> : std::true_type {};
+
 template<typename T>
 std::variant<T, StringConversionError> convertFromString(const std::string& data)
 {
     try {
-        const auto result = [&]
+        auto result = [&]
         {
-            if constexpr (eel::is_complete_type_v<StringConverter<T>>)
-                return StringConverter<T>::fromString(data);
+            if constexpr (eel::is_complete_type_v<StringConverter<T>>) {
+                if constexpr (has_string_view_converter<T>::value)
+                    return StringConverter<T>::fromString(std::string_view{data});
+                else
+                    return StringConverter<T>::fromString(data);
+            }
             else
                 return fromString<T>(data);
         }();
@@ -55,7 +118,7 @@ std::variant<T, StringConversionError> convertFromString(const std::string& data
         if (!result.has_value())
             return StringConversionError{};
         else
-            return result.value();
+            return std::move(result.value());
     }
     catch (const ValidationError& error) {
         return StringConversionError{error.what()};
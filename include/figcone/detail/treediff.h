@@ -0,0 +1,118 @@
+#ifndef FIGCONE_TREEDIFF_H
+#define FIGCONE_TREEDIFF_H
+
+#include <figcone_tree/tree.h>
+#include <string>
+#include <vector>
+
+namespace figcone::detail {
+
+inline bool isEqual(const TreeParam& lhs, const TreeParam& rhs)
+{
+    if (lhs.isItem() != rhs.isItem())
+        return false;
+    return lhs.isItem() ? lhs.value() == rhs.value() : lhs.valueList() == rhs.valueList();
+}
+
+//compares the fields and values of the nodes, their positions are ignored
+inline bool isEqual(const TreeNode& lhs, const TreeNode& rhs)
+{
+    if (lhs.isList() != rhs.isList())
+        return false;
+
+    if (lhs.isList()) {
+        const auto& lhsList = lhs.asList();
+        const auto& rhsList = rhs.asList();
+        if (lhsList.size() != rhsList.size())
+            return false;
+        for (auto i = 0; i < static_cast<int>(lhsList.size()); ++i)
+            if (!isEqual(lhsList.at(i), rhsList.at(i)))
+                return false;
+        return true;
+    }
+
+    const auto& lhsItem = lhs.asItem();
+    const auto& rhsItem = rhs.asItem();
+    if (lhsItem.paramNames().size() != rhsItem.paramNames().size() ||
+        lhsItem.nodeNames().size() != rhsItem.nodeNames().size())
+        return false;
+    for (const auto& paramName : lhsItem.paramNames())
+        if (!rhsItem.hasParam(paramName) || !isEqual(lhsItem.param(paramName), rhsItem.param(paramName)))
+            return false;
+    for (const auto& nodeName : lhsItem.nodeNames())
+        if (!rhsItem.hasNode(nodeName) || !isEqual(lhsItem.node(nodeName), rhsItem.node(nodeName)))
+            return false;
+    return true;
+}
+
+//Paths of the fields that differ between two config trees, path elements are separated with dots.
+//Nodes are compared field by field, while lists are reported as a whole.
+class TreeDiff {
+public:
+    TreeDiff(const TreeNode& previousRoot, const TreeNode& root)
+    {
+        compareItems(previousRoot.asItem(), root.asItem(), {});
+    }
+
+    const std::vector<std::string>& changedFields() const
+    {
+        return changedFields_;
+    }
+
+    std::vector<std::string>& changedFields()
+    {
+        return changedFields_;
+    }
+
+    //true if fields of the previous tree are missing in the new one
+    bool hasRemovedFields() const
+    {
+        return hasRemovedFields_;
+    }
+
+private:
+    void compareItems(const TreeNodeItem& previousItem, const TreeNodeItem& item, const std::string& path)
+    {
+        //fields changing their kind between a param and a node are reported once, as added fields
+        for (const auto& paramName : previousItem.paramNames())
+            if (!item.hasParam(paramName))
+                addRemovedField(path, paramName, !item.hasNode(paramName));
+        for (const auto& nodeName : previousItem.nodeNames())
+            if (!item.hasNode(nodeName))
+                addRemovedField(path, nodeName, !item.hasParam(nodeName));
+
+        for (const auto& paramName : item.paramNames())
+            if (!previousItem.hasParam(paramName) || !isEqual(previousItem.param(paramName), item.param(paramName)))
+                changedFields_.emplace_back(fieldPath(path, paramName));
+
+        for (const auto& nodeName : item.nodeNames()) {
+            const auto& node = item.node(nodeName);
+            if (!previousItem.hasNode(nodeName))
+                changedFields_.emplace_back(fieldPath(path, nodeName));
+            else if (const auto& previousNode = previousItem.node(nodeName); previousNode.isItem() && node.isItem())
+                compareItems(previousNode.asItem(), node.asItem(), fieldPath(path, nodeName));
+            else if (!isEqual(previousNode, node))
+                changedFields_.emplace_back(fieldPath(path, nodeName));
+        }
+    }
+
+    void addRemovedField(const std::string& path, const std::string& name, bool isReported)
+    {
+        if (isReported)
+            changedFields_.emplace_back(fieldPath(path, name));
+        hasRemovedFields_ = true;
+    }
+
+    static std::string fieldPath(const std::string& path, const std::string& name)
+    {
+        return path.empty() ? name : path + "." + name;
+    }
+
+private:
+    std::vector<std::string> changedFields_;
+    bool hasRemovedFields_ = false;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_TREEDIFF_H
\ No newline at end of file
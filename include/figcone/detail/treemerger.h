@@ -0,0 +1,204 @@
+#ifndef FIGCONE_TREEMERGER_H
+#define FIGCONE_TREEMERGER_H
+
+#include <figcone/errors.h>
+#include <figcone/listmergemode.h>
+#include <figcone_tree/tree.h>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace figcone::detail {
+
+//Merges trees of config layers into a single tree, fields of later layers override fields of earlier ones:
+//params and 'any' nodes are replaced, nodes are merged recursively,
+//param lists and node lists are either replaced or appended depending on the list merge mode.
+//If layers define a field with different kinds (e.g. a param and a node), the field from the latest layer is used.
+class TreeMerger {
+    enum class FieldKind {
+        Param,
+        ParamList,
+        Node,
+        NodeList,
+        Any
+    };
+
+public:
+    explicit TreeMerger(ListMergeMode listMergeMode)
+        : listMergeMode_{listMergeMode}
+    {
+    }
+
+    Tree merge(const std::vector<const Tree*>& layers) const
+    {
+        auto roots = std::vector<const TreeNode*>{};
+        for (const auto& layer : layers) {
+            if (layer->root().isList())
+                throw ConfigError{
+                        "Config layers with a list at the root level can't be merged",
+                        layer->root().position()};
+            roots.push_back(&layer->root());
+        }
+
+        auto root = makeTreeRoot();
+        mergeItems(roots, *root);
+        return Tree{std::move(root)};
+    }
+
+private:
+    void mergeItems(const std::vector<const TreeNode*>& layerNodes, TreeNode& result) const
+    {
+        auto& resultItem = result.asItem();
+        for (const auto& fieldName : fieldNames(layerNodes)) {
+            //layers defining the field, starting from the last one that changed its kind
+            auto fieldLayerNodes = std::vector<const TreeNode*>{};
+            auto kind = FieldKind{};
+            for (auto layerNode : layerNodes) {
+                const auto layerFieldKind = fieldKind(layerNode->asItem(), fieldName);
+                if (!layerFieldKind)
+                    continue;
+                if (layerFieldKind != kind)
+                    fieldLayerNodes.clear();
+                kind = *layerFieldKind;
+                fieldLayerNodes.push_back(layerNode);
+            }
+
+            const auto& lastItem = fieldLayerNodes.back()->asItem();
+            switch (kind) {
+            case FieldKind::Param:
+                copyParam(fieldName, lastItem.param(fieldName), resultItem);
+                break;
+            case FieldKind::ParamList:
+                mergeParamLists(fieldName, fieldLayerNodes, resultItem);
+                break;
+            case FieldKind::Node: {
+                auto nodes = std::vector<const TreeNode*>{};
+                for (auto layerNode : fieldLayerNodes)
+                    nodes.push_back(&layerNode->asItem().node(fieldName));
+                mergeItems(nodes, resultItem.addNode(fieldName, nodes.front()->position()));
+                break;
+            }
+            case FieldKind::NodeList:
+                mergeNodeLists(fieldName, fieldLayerNodes, resultItem);
+                break;
+            case FieldKind::Any: {
+                const auto& node = lastItem.node(fieldName);
+                copyNodeContent(node, resultItem.addAny(fieldName, node.position()));
+                break;
+            }
+            }
+        }
+    }
+
+    void mergeParamLists(
+            const std::string& name,
+            const std::vector<const TreeNode*>& layerNodes,
+            TreeNodeItem& result) const
+    {
+        if (listMergeMode_ == ListMergeMode::Replace) {
+            copyParam(name, layerNodes.back()->asItem().param(name), result);
+            return;
+        }
+
+        auto valueList = std::vector<std::string>{};
+        for (auto layerNode : layerNodes) {
+            const auto& layerValueList = layerNode->asItem().param(name).valueList();
+            valueList.insert(valueList.end(), layerValueList.begin(), layerValueList.end());
+        }
+        result.addParamList(name, valueList, layerNodes.front()->asItem().param(name).position());
+    }
+
+    void mergeNodeLists(
+            const std::string& name,
+            const std::vector<const TreeNode*>& layerNodes,
+            TreeNodeItem& result) const
+    {
+        if (listMergeMode_ == ListMergeMode::Replace) {
+            const auto& node = layerNodes.back()->asItem().node(name);
+            copyNodeContent(node, result.addNodeList(name, node.position()));
+            return;
+        }
+
+        auto& nodeList = result.addNodeList(name, layerNodes.front()->asItem().node(name).position());
+        for (auto layerNode : layerNodes)
+            copyNodeContent(layerNode->asItem().node(name), nodeList);
+    }
+
+    static void copyParam(const std::string& name, const TreeParam& param, TreeNodeItem& result)
+    {
+        if (param.isItem())
+            result.addParam(name, param.value(), param.position());
+        else
+            result.addParamList(name, param.valueList(), param.position());
+    }
+
+    //appends the content of the source node to the result node
+    static void copyNodeContent(const TreeNode& source, TreeNode& result)
+    {
+        if (source.isList()) {
+            const auto& sourceList = source.asList();
+            for (auto i = 0; i < static_cast<int>(sourceList.size()); ++i) {
+                const auto& element = sourceList.at(i);
+                copyNodeContent(
+                        element,
+                        element.isAny() ? result.asList().emplaceBackAny(element.position())
+                                        : result.asList().emplaceBack(element.position()));
+            }
+            return;
+        }
+
+        const auto& sourceItem = source.asItem();
+        auto& resultItem = result.asItem();
+        for (const auto& paramName : sourceItem.paramNames())
+            copyParam(paramName, sourceItem.param(paramName), resultItem);
+        for (const auto& nodeName : sourceItem.nodeNames()) {
+            const auto& node = sourceItem.node(nodeName);
+            if (node.isAny())
+                copyNodeContent(node, resultItem.addAny(nodeName, node.position()));
+            else if (node.isList())
+                copyNodeContent(node, resultItem.addNodeList(nodeName, node.position()));
+            else
+                copyNodeContent(node, resultItem.addNode(nodeName, node.position()));
+        }
+    }
+
+    static std::vector<std::string> fieldNames(const std::vector<const TreeNode*>& layerNodes)
+    {
+        auto result = std::vector<std::string>{};
+        auto addedNames = std::unordered_set<std::string>{};
+        auto addName = [&](const std::string& name)
+        {
+            if (addedNames.insert(name).second)
+                result.push_back(name);
+        };
+
+        for (auto layerNode : layerNodes) {
+            for (const auto& paramName : layerNode->asItem().paramNames())
+                addName(paramName);
+            for (const auto& nodeName : layerNode->asItem().nodeNames())
+                addName(nodeName);
+        }
+        return result;
+    }
+
+    static std::optional<FieldKind> fieldKind(const TreeNodeItem& item, const std::string& name)
+    {
+        if (item.hasParam(name))
+            return item.param(name).isItem() ? FieldKind::Param : FieldKind::ParamList;
+        if (!item.hasNode(name))
+            return std::nullopt;
+
+        const auto& node = item.node(name);
+        if (node.isAny())
+            return FieldKind::Any;
+        return node.isList() ? FieldKind::NodeList : FieldKind::Node;
+    }
+
+private:
+    ListMergeMode listMergeMode_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_TREEMERGER_H
\ No newline at end of file
@@ -0,0 +1,343 @@
+#ifndef FIGCONE_TREESNAPSHOT_H
+#define FIGCONE_TREESNAPSHOT_H
+
+#include "snapshotdata.h"
+#include <figcone_tree/streamposition.h>
+#include <figcone_tree/tree.h>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace figcone::detail {
+
+namespace tree_snapshot {
+inline constexpr auto magic = std::string_view{"FIGCONE\x02", 8};
+
+enum class NodeType : std::uint8_t {
+    Item,
+    List,
+    Any
+};
+
+enum class ParamType : std::uint8_t {
+    Item,
+    List
+};
+
+enum PositionFlags : std::uint8_t {
+    HasLine = 1,
+    HasColumn = 2
+};
+
+inline bool isSamePosition(const StreamPosition& lhs, const StreamPosition& rhs)
+{
+    return lhs.line == rhs.line && lhs.column == rhs.column;
+}
+} //namespace tree_snapshot
+
+//Serializes a parsed tree, so it can be restored without parsing the config again.
+//Content: table of field names, root node. Field names are stored as indices in the names table.
+class TreeSnapshotWriter {
+public:
+    //returns std::nullopt if the tree can't be restored from a snapshot exactly
+    static std::optional<std::string> write(const Tree& tree, const SnapshotKey& key)
+    {
+        const auto& root = tree.root();
+        if (root.isAny())
+            return std::nullopt;
+        const auto defaultRoot = root.isList() ? makeTreeRootList() : makeTreeRoot();
+        if (!tree_snapshot::isSamePosition(root.position(), defaultRoot->position()))
+            return std::nullopt;
+
+        auto body = TreeSnapshotWriter{};
+        body.writeNodeType(root);
+        if (!body.writeNodeContent(root))
+            return std::nullopt;
+
+        auto snapshot = SnapshotDataWriter{};
+        snapshot.writeHeader(tree_snapshot::magic, key);
+        snapshot.writeInt(body.names_.size());
+        for (const auto& name : body.names_)
+            snapshot.writeString(*name);
+        snapshot.writeBytes(body.data_.data());
+        return std::move(snapshot).finish();
+    }
+
+private:
+    void writeInt(std::uint64_t value)
+    {
+        data_.writeInt(value);
+    }
+
+    void writeString(std::string_view value)
+    {
+        data_.writeString(value);
+    }
+
+    void writeName(const std::string& name)
+    {
+        auto [it, isInserted] = nameIndex_.emplace(name, names_.size());
+        if (isInserted)
+            names_.push_back(&it->first);
+        writeInt(it->second);
+    }
+
+    void writePosition(const StreamPosition& position)
+    {
+        writeInt((position.line ? tree_snapshot::HasLine : 0) | (position.column ? tree_snapshot::HasColumn : 0));
+        if (position.line)
+            writeInt(static_cast<std::uint32_t>(*position.line));
+        if (position.column)
+            writeInt(static_cast<std::uint32_t>(*position.column));
+    }
+
+    void writeNodeType(const TreeNode& node)
+    {
+        if (node.isAny())
+            writeInt(static_cast<std::uint8_t>(tree_snapshot::NodeType::Any));
+        else if (node.isList())
+            writeInt(static_cast<std::uint8_t>(tree_snapshot::NodeType::List));
+        else
+            writeInt(static_cast<std::uint8_t>(tree_snapshot::NodeType::Item));
+    }
+
+    bool writeNodeContent(const TreeNode& node)
+    {
+        if (node.isList())
+            return writeNodeListContent(node);
+
+        const auto& item = node.asItem();
+        writeInt(item.paramNames().size());
+        for (const auto& paramName : item.paramNames()) {
+            const auto& param = item.param(paramName);
+            writeName(paramName);
+            writePosition(param.position());
+            if (param.isItem()) {
+                writeInt(static_cast<std::uint8_t>(tree_snapshot::ParamType::Item));
+                writeString(param.value());
+            }
+            else {
+                writeInt(static_cast<std::uint8_t>(tree_snapshot::ParamType::List));
+                writeInt(param.valueList().size());
+                for (const auto& value : param.valueList())
+                    writeString(value);
+            }
+        }
+
+        writeInt(item.nodeNames().size());
+        for (const auto& nodeName : item.nodeNames()) {
+            const auto& childNode = item.node(nodeName);
+            writeName(nodeName);
+            writePosition(childNode.position());
+            writeNodeType(childNode);
+            if (!writeNodeContent(childNode))
+                return false;
+        }
+        return true;
+    }
+
+    bool writeNodeListContent(const TreeNode& node)
+    {
+        const auto& nodeList = node.asList();
+        //the content of 'any' nodes that aren't stored as lists can't be accessed through the tree interface
+        if (node.isAny() && nodeList.size() == 0)
+            return false;
+
+        writeInt(nodeList.size());
+        for (auto i = 0; i < static_cast<int>(nodeList.size()); ++i) {
+            const auto& element = nodeList.at(i);
+            //only node lists of items or 'any' nodes can be restored with the tree interface
+            if (element.isList() && !element.isAny())
+                return false;
+            writePosition(element.position());
+            writeNodeType(element);
+            if (!writeNodeContent(element))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    SnapshotDataWriter data_;
+    std::unordered_map<std::string, std::size_t> nameIndex_;
+    std::vector<const std::string*> names_;
+};
+
+class TreeSnapshotReader {
+    using ReadError = SnapshotDataReader::ReadError;
+
+public:
+    //returns std::nullopt if the snapshot is damaged or was made for another config content or parser
+    static std::optional<Tree> read(std::string_view snapshot, const SnapshotKey& key)
+    {
+        auto data = SnapshotDataReader::open(snapshot, tree_snapshot::magic, key);
+        if (!data)
+            return std::nullopt;
+
+        auto reader = TreeSnapshotReader{*data};
+        try {
+            const auto nameCount = reader.readCount();
+            reader.names_.reserve(nameCount);
+            for (auto i = std::size_t{}; i < nameCount; ++i)
+                reader.names_.emplace_back(reader.readString());
+
+            auto root = std::unique_ptr<TreeNode>{};
+            switch (reader.readNodeType()) {
+            case tree_snapshot::NodeType::Item:
+                root = makeTreeRoot();
+                break;
+            case tree_snapshot::NodeType::List:
+                root = makeTreeRootList();
+                break;
+            default:
+                return std::nullopt;
+            }
+            reader.readNodeContent(*root);
+            if (!reader.data_.isFinished())
+                return std::nullopt;
+            return Tree{std::move(root)};
+        }
+        catch (const std::exception&) {
+            return std::nullopt;
+        }
+    }
+
+private:
+    explicit TreeSnapshotReader(const SnapshotDataReader& data)
+        : data_{data}
+    {
+    }
+
+    std::uint64_t readInt()
+    {
+        return data_.readInt();
+    }
+
+    std::size_t readCount()
+    {
+        return data_.readCount();
+    }
+
+    std::string readString()
+    {
+        return data_.readString();
+    }
+
+    const std::string& readName()
+    {
+        const auto index = readInt();
+        if (index >= names_.size())
+            throw ReadError{};
+        return names_[static_cast<std::size_t>(index)];
+    }
+
+    int readPositionValue()
+    {
+        const auto value = readInt();
+        if (value > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+            throw ReadError{};
+        return static_cast<int>(value);
+    }
+
+    StreamPosition readPosition()
+    {
+        const auto flags = readInt();
+        if (flags & ~std::uint64_t{tree_snapshot::HasLine | tree_snapshot::HasColumn})
+            throw ReadError{};
+
+        auto position = StreamPosition{};
+        if (flags & tree_snapshot::HasLine)
+            position.line = readPositionValue();
+        if (flags & tree_snapshot::HasColumn)
+            position.column = readPositionValue();
+        return position;
+    }
+
+    tree_snapshot::NodeType readNodeType()
+    {
+        const auto nodeType = readInt();
+        if (nodeType > static_cast<std::uint8_t>(tree_snapshot::NodeType::Any))
+            throw ReadError{};
+        return static_cast<tree_snapshot::NodeType>(nodeType);
+    }
+
+    void readNodeContent(TreeNode& node)
+    {
+        if (node.isList()) {
+            readNodeListContent(node);
+            return;
+        }
+
+        auto& item = node.asItem();
+        const auto paramCount = readCount();
+        for (auto i = std::size_t{}; i < paramCount; ++i) {
+            const auto& paramName = readName();
+            const auto position = readPosition();
+            const auto paramType = readInt();
+            if (paramType == static_cast<std::uint8_t>(tree_snapshot::ParamType::Item))
+                item.addParam(paramName, readString(), position);
+            else if (paramType == static_cast<std::uint8_t>(tree_snapshot::ParamType::List)) {
+                const auto valueCount = readCount();
+                auto valueList = std::vector<std::string>{};
+                valueList.reserve(valueCount);
+                for (auto j = std::size_t{}; j < valueCount; ++j)
+                    valueList.emplace_back(readString());
+                item.addParamList(paramName, valueList, position);
+            }
+            else
+                throw ReadError{};
+        }
+
+        const auto nodeCount = readCount();
+        for (auto i = std::size_t{}; i < nodeCount; ++i) {
+            const auto& nodeName = readName();
+            const auto position = readPosition();
+            switch (readNodeType()) {
+            case tree_snapshot::NodeType::Item:
+                readNodeContent(item.addNode(nodeName, position));
+                break;
+            case tree_snapshot::NodeType::List:
+                readNodeContent(item.addNodeList(nodeName, position));
+                break;
+            case tree_snapshot::NodeType::Any:
+                readNodeContent(item.addAny(nodeName, position));
+                break;
+            }
+        }
+    }
+
+    void readNodeListContent(TreeNode& node)
+    {
+        auto& nodeList = node.asList();
+        const auto elementCount = readCount();
+        for (auto i = std::size_t{}; i < elementCount; ++i) {
+            const auto position = readPosition();
+            switch (readNodeType()) {
+            case tree_snapshot::NodeType::Item:
+                readNodeContent(nodeList.emplaceBack(position));
+                break;
+            case tree_snapshot::NodeType::Any:
+                readNodeContent(nodeList.emplaceBackAny(position));
+                break;
+            default:
+                throw ReadError{};
+            }
+        }
+    }
+
+private:
+    SnapshotDataReader data_;
+    std::vector<std::string> names_;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_TREESNAPSHOT_H
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef FIGCONE_VIEWSTREAMBUF_H
+#define FIGCONE_VIEWSTREAMBUF_H
+
+#include <ios>
+#include <streambuf>
+#include <string_view>
+
+namespace figcone::detail {
+
+//Provides the contents of a string_view to std::istream without copying it
+class ViewStreamBuf : public std::streambuf {
+public:
+    explicit ViewStreamBuf(std::string_view data)
+    {
+        auto begin = const_cast<char*>(data.data());
+        setg(begin, begin, begin + data.size());
+    }
+
+protected:
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override
+    {
+        if (!(mode & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        const auto basePos = [&]() -> off_type
+        {
+            if (direction == std::ios_base::beg)
+                return 0;
+            if (direction == std::ios_base::cur)
+                return gptr() - eback();
+            return egptr() - eback();
+        }();
+        const auto pos = basePos + offset;
+        if (pos < 0 || pos > egptr() - eback())
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode mode) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, mode);
+    }
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_VIEWSTREAMBUF_H
\ No newline at end of file
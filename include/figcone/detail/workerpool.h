@@ -0,0 +1,189 @@
+#ifndef FIGCONE_WORKERPOOL_H
+#define FIGCONE_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace figcone::detail {
+
+//Threads shared by all parallel loads of the process. The pool grows to the largest requested worker count and keeps
+//its threads until the program exits, so parallel loads don't start new threads and concurrent loads share the same
+//threads instead of each starting its own.
+class WorkerPool {
+    struct Job {
+        std::function<void(std::size_t)> runWorker;
+        std::size_t workerCount;
+        std::atomic<std::size_t> nextWorkerIndex{1};
+        std::size_t finishedWorkerCount = 0;
+        std::mutex mutex;
+        std::condition_variable workerFinished;
+    };
+
+public:
+    static WorkerPool& instance()
+    {
+        static auto pool = WorkerPool{};
+        return pool;
+    }
+
+    ~WorkerPool()
+    {
+        {
+            auto lock = std::lock_guard{mutex_};
+            isStopped_ = true;
+        }
+        taskAdded_.notify_all();
+        for (auto& thread : threads_)
+            thread.join();
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    //Returns true on the threads running a worker, parallel loads started there run sequentially, so nested node
+    //lists don't occupy the pool threads that are needed by the outer load
+    static bool isWorkerThread()
+    {
+        return isWorkerThreadFlag();
+    }
+
+    //Calls runWorker(workerIndex) for every worker, the first worker runs on the calling thread. The calling thread
+    //also runs the workers that haven't been taken by the pool threads yet, so the call never waits for busy pool
+    //threads.
+    //runWorker must not throw.
+    template<typename TFunc>
+    void run(std::size_t workerCount, const TFunc& runWorker)
+    {
+        if (workerCount <= 1 || isWorkerThread()) {
+            for (auto workerIndex = std::size_t{}; workerIndex < workerCount; ++workerIndex)
+                runWorkerOnThisThread(runWorker, workerIndex);
+            return;
+        }
+
+        auto job = std::make_shared<Job>();
+        job->runWorker = [&runWorker](std::size_t workerIndex)
+        {
+            runWorker(workerIndex);
+        };
+        job->workerCount = workerCount;
+        addTasks(job);
+
+        runWorkerOnThisThread(runWorker, 0);
+        while (runNextWorker(*job)) {
+        }
+
+        auto lock = std::unique_lock{job->mutex};
+        job->workerFinished.wait(
+                lock,
+                [&]
+                {
+                    return job->finishedWorkerCount == workerCount - 1;
+                });
+    }
+
+private:
+    WorkerPool() = default;
+
+    static bool& isWorkerThreadFlag()
+    {
+        thread_local auto isWorkerThread = false;
+        return isWorkerThread;
+    }
+
+    template<typename TFunc>
+    static void runWorkerOnThisThread(const TFunc& runWorker, std::size_t workerIndex)
+    {
+        auto& isWorkerThread = isWorkerThreadFlag();
+        const auto wasWorkerThread = isWorkerThread;
+        isWorkerThread = true;
+        runWorker(workerIndex);
+        isWorkerThread = wasWorkerThread;
+    }
+
+    //Returns false when all workers of the job have been taken
+    static bool runNextWorker(Job& job)
+    {
+        const auto workerIndex = job.nextWorkerIndex++;
+        if (workerIndex >= job.workerCount)
+            return false;
+
+        runWorkerOnThisThread(job.runWorker, workerIndex);
+        {
+            auto lock = std::lock_guard{job.mutex};
+            ++job.finishedWorkerCount;
+        }
+        job.workerFinished.notify_one();
+        return true;
+    }
+
+    void addTasks(const std::shared_ptr<Job>& job)
+    {
+        {
+            auto lock = std::lock_guard{mutex_};
+            addThreads(job->workerCount - 1);
+            for (auto i = std::size_t{1}; i < job->workerCount; ++i)
+                tasks_.emplace_back(
+                        [job]
+                        {
+                            runNextWorker(*job);
+                        });
+        }
+        taskAdded_.notify_all();
+    }
+
+    void addThreads(std::size_t threadCount)
+    {
+        while (threads_.size() < threadCount) {
+            try {
+                threads_.emplace_back(
+                        [this]
+                        {
+                            processTasks();
+                        });
+            }
+            catch (const std::system_error&) {
+                //the workers not taken by the pool threads are run on the calling thread
+                return;
+            }
+        }
+    }
+
+    void processTasks()
+    {
+        while (true) {
+            auto task = std::function<void()>{};
+            {
+                auto lock = std::unique_lock{mutex_};
+                taskAdded_.wait(
+                        lock,
+                        [this]
+                        {
+                            return isStopped_ || !tasks_.empty();
+                        });
+                if (tasks_.empty())
+                    return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable taskAdded_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    bool isStopped_ = false;
+};
+
+} //namespace figcone::detail
+
+#endif //FIGCONE_WORKERPOOL_H
\ No newline at end of file
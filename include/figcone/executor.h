@@ -0,0 +1,14 @@
+#ifndef FIGCONE_EXECUTOR_H
+#define FIGCONE_EXECUTOR_H
+
+#include <functional>
+
+namespace figcone {
+
+//Runs the task, for example by posting it to a thread pool or to an event loop.
+//An empty executor runs each task on a new thread.
+using Executor = std::function<void(std::function<void()>)>;
+
+} //namespace figcone
+
+#endif //FIGCONE_EXECUTOR_H
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef FIGCONE_IBUFFERPARSER_H
+#define FIGCONE_IBUFFERPARSER_H
+
+#include <figcone_tree/tree.h>
+#include <string_view>
+
+namespace figcone {
+
+class IBufferParser {
+public:
+    virtual ~IBufferParser() = default;
+    virtual Tree parse(std::string_view buffer) = 0;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_IBUFFERPARSER_H
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef FIGCONE_LISTMERGEMODE_H
+#define FIGCONE_LISTMERGEMODE_H
+
+namespace figcone {
+
+enum class ListMergeMode {
+    Replace,
+    Append
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_LISTMERGEMODE_H
\ No newline at end of file
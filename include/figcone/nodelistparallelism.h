@@ -0,0 +1,16 @@
+#ifndef FIGCONE_NODELISTPARALLELISM_H
+#define FIGCONE_NODELISTPARALLELISM_H
+
+#include <cstddef>
+
+namespace figcone {
+
+struct NodeListParallelism {
+    //0 - use std::thread::hardware_concurrency()
+    int threadCount = 1;
+    std::size_t minNodeListSize = 1000;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_NODELISTPARALLELISM_H
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef FIGCONE_OVERLAYFIELDMATCHING_H
+#define FIGCONE_OVERLAYFIELDMATCHING_H
+
+namespace figcone {
+
+//Defines how the overlay fields that don't match any config field are handled
+enum class OverlayFieldMatching {
+    Strict,
+    IgnoreUnmatched
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_OVERLAYFIELDMATCHING_H
\ No newline at end of file
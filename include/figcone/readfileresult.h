@@ -0,0 +1,63 @@
+#ifndef FIGCONE_READFILERESULT_H
+#define FIGCONE_READFILERESULT_H
+
+#include "errors.h"
+#include <utility>
+#include <variant>
+
+namespace figcone {
+
+//Result of reading a single config file by ConfigReader::readFiles, stores either the config or the reading error
+template<typename TCfg>
+class ReadFileResult {
+public:
+    ReadFileResult(TCfg cfg)
+        : value_{std::in_place_index<0>, std::move(cfg)}
+    {
+    }
+
+    ReadFileResult(ConfigError error)
+        : value_{std::in_place_index<1>, std::move(error)}
+    {
+    }
+
+    bool hasError() const
+    {
+        return value_.index() == 1;
+    }
+
+    //throws std::bad_variant_access if the file was read successfully
+    const ConfigError& error() const
+    {
+        return std::get<1>(value_);
+    }
+
+    //throws the reading error if the file wasn't read successfully
+    TCfg& value() &
+    {
+        if (hasError())
+            throw error();
+        return std::get<0>(value_);
+    }
+
+    const TCfg& value() const&
+    {
+        if (hasError())
+            throw error();
+        return std::get<0>(value_);
+    }
+
+    TCfg&& value() &&
+    {
+        if (hasError())
+            throw error();
+        return std::get<0>(std::move(value_));
+    }
+
+private:
+    std::variant<TCfg, ConfigError> value_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_READFILERESULT_H
\ No newline at end of file
@@ -0,0 +1,157 @@
+#ifndef FIGCONE_RELOADABLECONFIG_H
+#define FIGCONE_RELOADABLECONFIG_H
+
+#include "configreader.h"
+#include "errors.h"
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+
+//Config read from a file, which is read again on each reload() call.
+//Each reload publishes a new immutable config object, so readers holding the result of get() keep a consistent view
+//of the config. Reloading compares the parsed config with the previous one and updates a copy of the current config by
+//loading only the changed fields, validators of unchanged nodes aren't called again.
+template<typename TCfg>
+class ReloadableConfig {
+public:
+    //Reads the config file, throws ConfigError if it can't be read
+    ReloadableConfig(
+            std::filesystem::path configFile,
+            std::unique_ptr<IParser> parser,
+            ConfigReader configReader = ConfigReader{})
+        : configFile_{std::move(configFile)}
+        , parser_{std::move(parser)}
+        , configReader_{std::move(configReader)}
+    {
+        auto tree = parseConfigFile();
+        store(std::make_shared<const TCfg>(configReader_.readBound<TCfg>(tree, boundCfg_)));
+        tree_.emplace(std::move(tree));
+    }
+
+    ReloadableConfig(const ReloadableConfig&) = delete;
+    ReloadableConfig& operator=(const ReloadableConfig&) = delete;
+
+    std::shared_ptr<const TCfg> get() const
+    {
+#ifdef __cpp_lib_atomic_shared_ptr
+        return cfg_.load();
+#else
+        return std::atomic_load(&cfg_);
+#endif
+    }
+
+    //Rereads the config file and returns the paths of the changed fields, the config object is replaced only if some
+    //fields are changed. Throws ConfigError and keeps the current config if the file can't be read.
+    //After the new config is published, the subscribers of the changed fields are notified.
+    std::vector<std::string> reload()
+    {
+        auto lock = std::lock_guard{reloadMutex_};
+        auto tree = parseConfigFile();
+        auto changedFields = std::vector<std::string>{};
+        if (auto cfg = configReader_.readChanges<TCfg>(boundCfg_, *tree_, tree, changedFields))
+            store(std::make_shared<const TCfg>(std::move(*cfg)));
+        tree_.emplace(std::move(tree));
+        if (!changedFields.empty())
+            notifySubscribers(changedFields);
+        return changedFields;
+    }
+
+    //Subscribes to the changes of the field with the specified path, which consists of the field names used in the
+    //config file separated with dots, e.g. "database.host". The callback is called with the new config once per reload
+    //that changes the field, its nested fields or the node containing it.
+    //Callbacks are called on the reloading thread and must not call reload() or subscribe().
+    void subscribe(std::string fieldPath, std::function<void(const TCfg&)> callback)
+    {
+        auto lock = std::lock_guard{reloadMutex_};
+        subscriptions_.push_back(Subscription{std::move(fieldPath), std::move(callback)});
+    }
+
+    //Subscribes to the changes of the config field, e.g. &Cfg::database, the callback is called with its new value
+    template<typename TField, typename TCallback>
+    void subscribe(TField TCfg::*member, TCallback callback)
+    {
+        static_assert(
+                std::is_invocable_v<TCallback, const TField&>,
+                "Subscription callback must be invocable with the value of the field");
+        auto lock = std::lock_guard{reloadMutex_};
+        subscriptions_.push_back(Subscription{
+                configReader_.fieldName(member),
+                [member, callback = std::move(callback)](const TCfg& cfg)
+                {
+                    callback(cfg.*member);
+                }});
+    }
+
+private:
+    Tree parseConfigFile()
+    {
+        ConfigReader::checkConfigFile(configFile_);
+        return ConfigReader::parseFile(configFile_, *parser_);
+    }
+
+    void notifySubscribers(const std::vector<std::string>& changedFields)
+    {
+        const auto cfg = get();
+        for (const auto& subscription : subscriptions_) {
+            for (const auto& changedField : changedFields) {
+                if (isRelatedField(subscription.fieldPath, changedField)) {
+                    subscription.callback(*cfg);
+                    break;
+                }
+            }
+        }
+    }
+
+    //checks if one of the fields is the same as the other field or contains it
+    static bool isRelatedField(std::string_view lhs, std::string_view rhs)
+    {
+        if (lhs.size() > rhs.size())
+            std::swap(lhs, rhs);
+        return rhs.substr(0, lhs.size()) == lhs && (rhs.size() == lhs.size() || rhs[lhs.size()] == '.');
+    }
+
+    void store(std::shared_ptr<const TCfg> cfg)
+    {
+#ifdef __cpp_lib_atomic_shared_ptr
+        cfg_.store(std::move(cfg));
+#else
+        std::atomic_store(&cfg_, std::move(cfg));
+#endif
+    }
+
+private:
+    struct Subscription {
+        std::string fieldPath;
+        std::function<void(const TCfg&)> callback;
+    };
+
+    std::filesystem::path configFile_;
+    std::unique_ptr<IParser> parser_;
+    ConfigReader configReader_;
+    std::mutex reloadMutex_;
+    std::optional<Tree> tree_;
+    //the current config before it's post-processed, the changed fields are loaded into its copy on reload
+    TCfg boundCfg_;
+    std::vector<Subscription> subscriptions_;
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::atomic<std::shared_ptr<const TCfg>> cfg_;
+#else
+    std::shared_ptr<const TCfg> cfg_;
+#endif
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_RELOADABLECONFIG_H
\ No newline at end of file
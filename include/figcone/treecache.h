@@ -0,0 +1,191 @@
+#ifndef FIGCONE_TREECACHE_H
+#define FIGCONE_TREECACHE_H
+
+#include <figcone_tree/tree.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+namespace figcone {
+class ConfigReader;
+
+//Cache of parsed config trees, which can be shared between ConfigReader instances to avoid parsing the same file
+//multiple times. Cached trees are keyed by the file's canonical path and the parser's type, and are reused while the
+//file's modification time and size stay the same. Least recently used trees are evicted when the approximate memory
+//usage of the cached trees exceeds maxMemoryUsage.
+class TreeCache {
+    struct FileState {
+        std::filesystem::file_time_type modificationTime;
+        std::uintmax_t size = 0;
+
+        friend bool operator==(const FileState& lhs, const FileState& rhs)
+        {
+            return lhs.modificationTime == rhs.modificationTime && lhs.size == rhs.size;
+        }
+    };
+
+    struct Entry {
+        std::string key;
+        FileState fileState;
+        std::shared_ptr<const Tree> tree;
+        std::size_t memoryUsage = 0;
+    };
+
+public:
+    explicit TreeCache(std::size_t maxMemoryUsage = 64 * 1024 * 1024)
+        : maxMemoryUsage_{maxMemoryUsage}
+    {
+    }
+
+    TreeCache(const TreeCache&) = delete;
+    TreeCache& operator=(const TreeCache&) = delete;
+
+    std::size_t size() const
+    {
+        auto lock = std::lock_guard{mutex_};
+        return entries_.size();
+    }
+
+    std::size_t memoryUsage() const
+    {
+        auto lock = std::lock_guard{mutex_};
+        return memoryUsage_;
+    }
+
+    void clear()
+    {
+        auto lock = std::lock_guard{mutex_};
+        entries_.clear();
+        index_.clear();
+        memoryUsage_ = 0;
+    }
+
+private:
+    //Files are parsed outside the lock, so concurrent reads of the same uncached file can parse it more than once
+    template<typename TParseFunc>
+    std::shared_ptr<const Tree> tree(
+            const std::filesystem::path& configFile,
+            std::string_view parserName,
+            const TParseFunc& parseFunc)
+    {
+        auto error = std::error_code{};
+        const auto canonicalPath = std::filesystem::canonical(configFile, error);
+        if (error)
+            return std::make_shared<const Tree>(parseFunc());
+
+        auto key = canonicalPath.string();
+        key.append(1, '\0').append(parserName);
+        const auto fileState = readFileState(canonicalPath);
+        if (fileState)
+            if (auto cachedTree = findTree(key, *fileState))
+                return cachedTree;
+
+        auto tree = std::make_shared<const Tree>(parseFunc());
+        //the file could be modified during the parsing, in that case the tree isn't cached
+        if (fileState && fileState == readFileState(canonicalPath))
+            addTree(std::move(key), *fileState, tree);
+        return tree;
+    }
+
+    static std::optional<FileState> readFileState(const std::filesystem::path& configFile)
+    {
+        auto error = std::error_code{};
+        auto fileState = FileState{std::filesystem::last_write_time(configFile, error), 0};
+        if (error)
+            return std::nullopt;
+        fileState.size = std::filesystem::file_size(configFile, error);
+        if (error)
+            return std::nullopt;
+        return fileState;
+    }
+
+    std::shared_ptr<const Tree> findTree(const std::string& key, const FileState& fileState)
+    {
+        auto lock = std::lock_guard{mutex_};
+        auto it = index_.find(key);
+        if (it == index_.end() || !(it->second->fileState == fileState))
+            return nullptr;
+
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->tree;
+    }
+
+    void addTree(std::string key, const FileState& fileState, std::shared_ptr<const Tree> tree)
+    {
+        const auto treeMemoryUsage = memoryUsageOf(*tree);
+        auto lock = std::lock_guard{mutex_};
+        if (auto it = index_.find(key); it != index_.end())
+            erase(it->second);
+        if (treeMemoryUsage > maxMemoryUsage_)
+            return;
+
+        while (memoryUsage_ + treeMemoryUsage > maxMemoryUsage_)
+            erase(std::prev(entries_.end()));
+
+        entries_.push_front(Entry{std::move(key), fileState, std::move(tree), treeMemoryUsage});
+        index_.emplace(entries_.front().key, entries_.begin());
+        memoryUsage_ += treeMemoryUsage;
+    }
+
+    void erase(std::list<Entry>::iterator entryIt)
+    {
+        memoryUsage_ -= entryIt->memoryUsage;
+        index_.erase(entryIt->key);
+        entries_.erase(entryIt);
+    }
+
+    static std::size_t memoryUsageOf(const Tree& tree)
+    {
+        return memoryUsageOf(tree.root());
+    }
+
+    //approximate, counts the stored strings and a fixed overhead of each tree entity
+    static std::size_t memoryUsageOf(const TreeNode& node)
+    {
+        constexpr auto entryOverhead = 4 * sizeof(void*);
+        auto result = sizeof(TreeNode) + entryOverhead;
+        if (node.isList()) {
+            const auto& nodeList = node.asList();
+            for (auto i = 0; i < static_cast<int>(nodeList.size()); ++i)
+                result += memoryUsageOf(nodeList.at(i));
+            return result;
+        }
+
+        const auto& item = node.asItem();
+        for (const auto& paramName : item.paramNames()) {
+            const auto& param = item.param(paramName);
+            result += sizeof(TreeParam) + entryOverhead + paramName.size();
+            if (param.isItem())
+                result += param.value().size();
+            else
+                for (const auto& value : param.valueList())
+                    result += sizeof(std::string) + value.size();
+        }
+        for (const auto& nodeName : item.nodeNames())
+            result += nodeName.size() + memoryUsageOf(item.node(nodeName));
+        return result;
+    }
+
+private:
+    std::size_t maxMemoryUsage_;
+    mutable std::mutex mutex_;
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    std::size_t memoryUsage_ = 0;
+
+    friend class ConfigReader;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_TREECACHE_H
\ No newline at end of file
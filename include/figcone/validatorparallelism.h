@@ -0,0 +1,13 @@
+#ifndef FIGCONE_VALIDATORPARALLELISM_H
+#define FIGCONE_VALIDATORPARALLELISM_H
+
+namespace figcone {
+
+struct ValidatorParallelism {
+    //0 - use std::thread::hardware_concurrency()
+    int threadCount = 1;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_VALIDATORPARALLELISM_H
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef FIGCONE_WATCHED_H
+#define FIGCONE_WATCHED_H
+
+#include "configreader.h"
+#include "errors.h"
+#include "reloadableconfig.h"
+#include "detail/filewatcher.h"
+#include <figcone_tree/iparser.h>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace figcone {
+
+//ReloadableConfig that is reloaded on a background thread when the config file changes.
+//If reloading fails, the previous config is kept and the error is passed to the error handler, which is called on the
+//watching thread. Errors that aren't ConfigError are passed to it as ConfigError too. Changes of the file are
+//collected during the debounce interval before reloading, so the file that is being written is read once.
+template<typename TCfg>
+class Watched {
+public:
+    Watched(std::filesystem::path configFile,
+            std::unique_ptr<IParser> parser,
+            std::function<void(const ConfigError&)> errorHandler = {},
+            std::chrono::milliseconds debounceInterval = std::chrono::milliseconds{100},
+            ConfigReader configReader = ConfigReader{})
+        : fileWatcher_{configFile, std::max(debounceInterval, std::chrono::milliseconds{100})}
+        , cfg_{std::move(configFile), std::move(parser), std::move(configReader)}
+        , errorHandler_{std::move(errorHandler)}
+        , debounceInterval_{debounceInterval}
+        , watchThread_{&Watched::watch, this}
+    {
+    }
+
+    ~Watched()
+    {
+        fileWatcher_.stop();
+        watchThread_.join();
+    }
+
+    Watched(const Watched&) = delete;
+    Watched& operator=(const Watched&) = delete;
+
+    std::shared_ptr<const TCfg> get() const
+    {
+        return cfg_.get();
+    }
+
+    //Rereads the config file immediately, see ReloadableConfig::reload()
+    std::vector<std::string> reload()
+    {
+        return cfg_.reload();
+    }
+
+    //Subscribes to the changes of the field, see ReloadableConfig::subscribe().
+    //Callbacks are called on the watching thread.
+    void subscribe(std::string fieldPath, std::function<void(const TCfg&)> callback)
+    {
+        cfg_.subscribe(std::move(fieldPath), std::move(callback));
+    }
+
+    template<typename TField, typename TCallback>
+    void subscribe(TField TCfg::*member, TCallback callback)
+    {
+        cfg_.subscribe(member, std::move(callback));
+    }
+
+private:
+    void watch()
+    {
+        using WaitResult = detail::FileWatcher::WaitResult;
+        for (;;) {
+            auto waitResult = fileWatcher_.wait(std::nullopt);
+            while (waitResult == WaitResult::Changed)
+                waitResult = fileWatcher_.wait(debounceInterval_);
+            if (waitResult == WaitResult::Stopped)
+                return;
+
+            //errors of parsers and user types aren't always ConfigError, none of them may stop the watching thread
+            try {
+                cfg_.reload();
+            }
+            catch (const ConfigError& error) {
+                handleError(error);
+            }
+            catch (const std::exception& error) {
+                handleError(ConfigError{std::string{"Couldn't reload config: "} + error.what()});
+            }
+            catch (...) {
+                handleError(ConfigError{"Couldn't reload config: unknown error"});
+            }
+        }
+    }
+
+    void handleError(const ConfigError& error)
+    {
+        if (errorHandler_)
+            errorHandler_(error);
+    }
+
+private:
+    //the watcher is created before reading the config, so the changes made during the reading aren't missed
+    detail::FileWatcher fileWatcher_;
+    ReloadableConfig<TCfg> cfg_;
+    std::function<void(const ConfigError&)> errorHandler_;
+    std::chrono::milliseconds debounceInterval_;
+    std::thread watchThread_;
+};
+
+} //namespace figcone
+
+#endif //FIGCONE_WATCHED_H
\ No newline at end of file
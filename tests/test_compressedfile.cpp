@@ -0,0 +1,233 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/ibufferparser.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#ifdef FIGCONE_ZLIB_AVAILABLE
+#include <zlib.h>
+#endif
+
+#ifdef FIGCONE_ZSTD_AVAILABLE
+#include <zstd.h>
+#endif
+
+namespace test_compressedfile {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(test, std::string);
+};
+
+//parses configs in the "name=value" format containing a single parameter
+figcone::Tree parseSingleParam(std::string_view config)
+{
+    auto tree = figcone::makeTreeRoot();
+    const auto delimPos = config.find('=');
+    if (delimPos != std::string_view::npos)
+        tree->asItem().addParam(
+                std::string{config.substr(0, delimPos)},
+                std::string{config.substr(delimPos + 1)},
+                {1, 1});
+    return tree;
+}
+
+class StreamParser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        ++streamParseCount;
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        return parseSingleParam(config);
+    }
+
+    int streamParseCount = 0;
+};
+
+class BufferParser : public StreamParser,
+                     public figcone::IBufferParser {
+public:
+    using StreamParser::parse;
+
+    figcone::Tree parse(std::string_view buffer) override
+    {
+        ++bufferParseCount;
+        return parseSingleParam(buffer);
+    }
+
+    int bufferParseCount = 0;
+};
+
+#ifdef FIGCONE_ZLIB_AVAILABLE
+std::string gzipCompress(const std::string& data)
+{
+    auto stream = z_stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    auto result = std::string(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(result.data());
+    stream.avail_out = static_cast<uInt>(result.size());
+    deflate(&stream, Z_FINISH);
+    result.resize(stream.total_out);
+    deflateEnd(&stream);
+    return result;
+}
+#endif
+
+#ifdef FIGCONE_ZSTD_AVAILABLE
+std::string zstdCompress(const std::string& data)
+{
+    auto result = std::string(ZSTD_compressBound(data.size()), '\0');
+    result.resize(ZSTD_compress(result.data(), result.size(), data.data(), data.size(), 1));
+    return result;
+}
+#endif
+
+class TestCompressedFile : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto testName = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+        configFile_ = std::filesystem::temp_directory_path() / ("figcone_test_compressedfile_" + testName);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(configFile_);
+    }
+
+    void writeConfig(const std::string& config)
+    {
+        auto stream = std::ofstream{configFile_, std::ios_base::binary};
+        stream << config;
+    }
+
+    std::string readError()
+    {
+        auto parser = StreamParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        try {
+            cfgReader.readFile<Cfg>(configFile_, parser);
+        }
+        catch (const figcone::ConfigError& error) {
+            return error.what();
+        }
+        return {};
+    }
+
+    std::filesystem::path configFile_;
+};
+
+#ifdef FIGCONE_ZLIB_AVAILABLE
+TEST_F(TestCompressedFile, Gzip)
+{
+    writeConfig(gzipCompress("test=hello world"));
+    auto parser = StreamParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+}
+
+TEST_F(TestCompressedFile, GzipWithBufferParser)
+{
+    writeConfig(gzipCompress("test=hello world"));
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFileMapped<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 0);
+    EXPECT_EQ(parser.streamParseCount, 1);
+}
+
+TEST_F(TestCompressedFile, LargeGzip)
+{
+    const auto value = std::string(1024 * 1024, 'x') + "y";
+    writeConfig(gzipCompress("test=" + value));
+    auto parser = StreamParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, value);
+}
+
+TEST_F(TestCompressedFile, ConcatenatedGzipMembers)
+{
+    writeConfig(gzipCompress("test=hello ") + gzipCompress("world"));
+    auto parser = StreamParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+}
+
+TEST_F(TestCompressedFile, TruncatedGzip)
+{
+    const auto data = gzipCompress("test=hello world");
+    writeConfig(data.substr(0, data.size() - 4));
+    EXPECT_EQ(readError(), "Can't decompress gzip config: unexpected end of data");
+}
+
+TEST_F(TestCompressedFile, DamagedGzip)
+{
+    auto data = gzipCompress("test=hello world");
+    data[12] = static_cast<char>(~data[12]);
+    data[13] = static_cast<char>(~data[13]);
+    writeConfig(data);
+    EXPECT_EQ(readError().rfind("Can't decompress gzip config: ", 0), 0);
+}
+#else
+TEST_F(TestCompressedFile, GzipIsNotSupported)
+{
+    writeConfig("\x1F\x8B\x08\x00");
+    EXPECT_EQ(readError(), "Can't read gzip compressed config, figcone is built without zlib support");
+}
+#endif
+
+#ifdef FIGCONE_ZSTD_AVAILABLE
+TEST_F(TestCompressedFile, Zstd)
+{
+    writeConfig(zstdCompress("test=hello world"));
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.streamParseCount, 1);
+}
+
+TEST_F(TestCompressedFile, LargeZstd)
+{
+    const auto value = std::string(1024 * 1024, 'x') + "y";
+    writeConfig(zstdCompress("test=" + value));
+    auto parser = StreamParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, value);
+}
+
+TEST_F(TestCompressedFile, TruncatedZstd)
+{
+    const auto data = zstdCompress("test=hello world");
+    writeConfig(data.substr(0, data.size() - 4));
+    EXPECT_EQ(readError(), "Can't decompress zstd config: unexpected end of data");
+}
+#else
+TEST_F(TestCompressedFile, ZstdIsNotSupported)
+{
+    writeConfig("\x28\xB5\x2F\xFD");
+    EXPECT_EQ(readError(), "Can't read zstd compressed config, figcone is built without zstd support");
+}
+#endif
+
+} //namespace test_compressedfile
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_concurrentread {
+
+struct EndpointCfg : public figcone::Config {
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(port, int).ensure(
+            [](int port)
+            {
+                if (port <= 0)
+                    throw figcone::ValidationError{"port must be positive"};
+            });
+};
+
+struct ServiceCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_NODE(endpoint, EndpointCfg);
+    FIGCONE_NODELIST(replicas, std::vector<EndpointCfg>);
+};
+
+struct LimitsCfg : public figcone::Config {
+    FIGCONE_PARAM(maxConnections, int);
+    FIGCONE_PARAMLIST(weights, std::vector<double>)();
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+void addEndpoint(figcone::TreeNode& node, const std::string& host, int port)
+{
+    node.asItem().addParam("host", host, {1, 1});
+    node.asItem().addParam("port", std::to_string(port), {2, 1});
+}
+
+ServiceCfg readService(figcone::ConfigReader& cfgReader, int id, int port)
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "service" + std::to_string(id), {1, 1});
+    addEndpoint(tree->asItem().addNode("endpoint", {2, 1}), "host" + std::to_string(id), port);
+    auto& replicas = tree->asItem().addNodeList("replicas", {3, 1});
+    for (auto i = 0; i < id % 5; ++i)
+        addEndpoint(replicas.asList().emplaceBack({4 + i, 1}), "replica" + std::to_string(i), port + i);
+
+    auto parser = TreeProvider{std::move(tree)};
+    return cfgReader.read<ServiceCfg>("", parser);
+}
+
+LimitsCfg readLimits(figcone::ConfigReader& cfgReader, int id)
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("maxConnections", std::to_string(id), {1, 1});
+    if (id % 2)
+        tree->asItem().addParamList("weights", {"0.5", std::to_string(id)}, {2, 1});
+
+    auto parser = TreeProvider{std::move(tree)};
+    return cfgReader.read<LimitsCfg>("", parser);
+}
+
+TEST(TestConcurrentRead, SharedConfigReader)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    const auto threadsCount = 8;
+    const auto iterationsCount = 200;
+    auto failuresCount = std::atomic<int>{};
+    auto threads = std::vector<std::thread>{};
+    for (auto threadIndex = 0; threadIndex < threadsCount; ++threadIndex)
+        threads.emplace_back(
+                [&, threadIndex]
+                {
+                    for (auto i = 0; i < iterationsCount; ++i) {
+                        const auto id = threadIndex * iterationsCount + i;
+                        try {
+                            if (i % 7 == 0) {
+                                readService(cfgReader, id, 0);
+                                ++failuresCount;
+                            }
+                        }
+                        catch (const figcone::ConfigError&) {
+                        }
+
+                        const auto service = readService(cfgReader, id, 1000 + id);
+                        if (service.name != "service" + std::to_string(id) ||
+                            service.endpoint.host != "host" + std::to_string(id) ||
+                            service.endpoint.port != 1000 + id || service.replicas.size() != id % 5u)
+                            ++failuresCount;
+                        for (auto replicaIndex = 0u; replicaIndex < service.replicas.size(); ++replicaIndex)
+                            if (service.replicas[replicaIndex].port != 1000 + id + static_cast<int>(replicaIndex))
+                                ++failuresCount;
+
+                        const auto limits = readLimits(cfgReader, id);
+                        if (limits.maxConnections != id || limits.weights.size() != (id % 2 ? 2u : 0u))
+                            ++failuresCount;
+                    }
+                });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(failuresCount, 0);
+}
+
+} //namespace test_concurrentread
\ No newline at end of file
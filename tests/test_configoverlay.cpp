@@ -0,0 +1,402 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configoverlay.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace test_configoverlay {
+
+struct Database : public figcone::Config {
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(poolSize, int);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAMLIST(ports, std::vector<int>)();
+    FIGCONE_PARAMLIST(tags, std::vector<std::string>)();
+    FIGCONE_NODE(database, Database);
+};
+
+struct ReplicatedCfg : public figcone::Config {
+    FIGCONE_NODELIST(replicas, std::vector<Database>);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+std::unique_ptr<figcone::TreeNode> makeTree(const std::string& poolSizeName = "poolSize")
+{
+    ///
+    /// name = app
+    /// [database]
+    ///   host = localhost
+    ///   poolSize = 8
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "app", {1, 1});
+    auto& database = tree->asItem().addNode("database", {2, 1});
+    database.asItem().addParam("host", "localhost", {3, 3});
+    database.asItem().addParam(poolSizeName, "8", {4, 3});
+    return tree;
+}
+
+void setEnvironmentVariable(const char* name, const char* value)
+{
+#ifdef _WIN32
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 1);
+#endif
+}
+
+TEST(TestConfigOverlay, EnvironmentVariables)
+{
+    setEnvironmentVariable("FIGCONE_TEST_OVERLAY_DATABASE__POOL_SIZE", "64");
+    setEnvironmentVariable("FIGCONE_TEST_OVERLAY_PORTS", "[80, 443]");
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addEnvironment("FIGCONE_TEST_OVERLAY_");
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.name, "app");
+    EXPECT_EQ(cfg.database.host, "localhost");
+    EXPECT_EQ(cfg.database.poolSize, 64);
+    EXPECT_EQ(cfg.ports, (std::vector<int>{80, 443}));
+}
+
+TEST(TestConfigOverlay, CommandLineArguments)
+{
+    const char* argv[] = {"app", "-v", "--database.pool-size=16", "--name=overridden", "input.txt"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addCommandLine(5, argv);
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.name, "overridden");
+    EXPECT_EQ(cfg.database.poolSize, 16);
+}
+
+TEST(TestConfigOverlay, BracketedParamValueIsNotList)
+{
+    const char* argv[] = {"app", "--name=[primary]"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addCommandLine(2, argv);
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.name, "[primary]");
+}
+
+TEST(TestConfigOverlay, EscapedCommasInParamList)
+{
+    const char* argv[] = {"app", R"(--tags=[a\, b, c\\, d\e])"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addCommandLine(2, argv);
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.tags, (std::vector<std::string>{"a, b", "c\\", R"(d\e)"}));
+}
+
+TEST(TestConfigOverlay, LaterValuesOverrideEarlierOnes)
+{
+    const char* argv[] = {"app", "--database.poolSize=32"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.set("DATABASE.POOL_SIZE", "16");
+    overlay.addCommandLine(2, argv);
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.database.poolSize, 32);
+}
+
+TEST(TestConfigOverlay, ConvertedNames)
+{
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.set("database.poolSize", "64");
+
+    auto parser = TreeProvider{makeTree("pool_size")};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::SnakeCase};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.database.poolSize, 64);
+}
+
+TEST(TestConfigOverlay, MissingFieldsAreProvidedByOverlay)
+{
+    ///
+    /// name = app
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "app", {1, 1});
+
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.set("database.host", "db.local");
+    overlay.set("database.poolSize", "4");
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.database.host, "db.local");
+    EXPECT_EQ(cfg.database.poolSize, 4);
+}
+
+TEST(TestConfigOverlay, OverlayIsAppliedToEveryRead)
+{
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.set("database.poolSize", "64");
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    {
+        auto parser = TreeProvider{makeTree()};
+        EXPECT_EQ(cfgReader.read<Cfg>("", parser).database.poolSize, 64);
+    }
+    {
+        auto parser = TreeProvider{makeTree()};
+        EXPECT_EQ(cfgReader.read<Cfg>("", parser).database.poolSize, 64);
+    }
+
+    cfgReader.setOverlay({});
+    auto parser = TreeProvider{makeTree()};
+    EXPECT_EQ(cfgReader.read<Cfg>("", parser).database.poolSize, 8);
+}
+
+TEST(TestConfigOverlay, UnknownParamError)
+{
+    const char* argv[] = {"app", "--database.size=16"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addCommandLine(2, argv);
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Command line argument '--database.size=16' doesn't match any config parameter");
+            });
+}
+
+TEST(TestConfigOverlay, UnknownNodeError)
+{
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.set("db.host", "localhost");
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Overlay field 'db.host' doesn't match any config node");
+            });
+}
+
+TEST(TestConfigOverlay, NodeListFieldError)
+{
+    ///
+    /// [[replicas]]
+    ///   host = localhost
+    ///   poolSize = 8
+    ///
+    auto tree = figcone::makeTreeRoot();
+    auto& replicas = tree->asItem().addNodeList("replicas", {1, 1});
+    auto& replica = replicas.asList().emplaceBack({1, 1});
+    replica.asItem().addParam("host", "localhost", {2, 3});
+    replica.asItem().addParam("poolSize", "8", {3, 3});
+
+    const char* argv[] = {"app", "--replicas.host=db.local"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addCommandLine(2, argv);
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<ReplicatedCfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Command line argument '--replicas.host=db.local': fields of node 'replicas' can't be "
+                        "overridden");
+            });
+}
+
+TEST(TestConfigOverlay, InvalidValueError)
+{
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.set("database.poolSize", "many");
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Overlay field 'database.poolSize': Couldn't set parameter 'poolSize' value from 'many'");
+            });
+}
+
+TEST(TestConfigOverlay, EmptyFieldNameError)
+{
+    auto overlay = figcone::ConfigOverlay{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                overlay.set("database..poolSize", "64");
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "Overlay field 'database..poolSize' has an empty field name");
+            });
+}
+
+TEST(TestConfigOverlay, UnmatchedEnvironmentVariablesAreIgnored)
+{
+    setEnvironmentVariable("FIGCONE_TEST_IGNORED_DATABASE__POOL_SIZE", "64");
+    setEnvironmentVariable("FIGCONE_TEST_IGNORED_DATABASE__TIMEOUT", "10");
+    setEnvironmentVariable("FIGCONE_TEST_IGNORED_LOG__LEVEL", "debug");
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addEnvironment("FIGCONE_TEST_IGNORED_");
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.database.poolSize, 64);
+}
+
+TEST(TestConfigOverlay, UnmatchedEnvironmentVariableErrorInStrictMode)
+{
+    setEnvironmentVariable("FIGCONE_TEST_STRICT_DATABASE__TIMEOUT", "10");
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addEnvironment("FIGCONE_TEST_STRICT_", "__", figcone::OverlayFieldMatching::Strict);
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Environment variable 'FIGCONE_TEST_STRICT_DATABASE__TIMEOUT' doesn't match any config "
+                        "parameter");
+            });
+}
+
+TEST(TestConfigOverlay, ConflictingEnvironmentVariablesError)
+{
+    setEnvironmentVariable("FIGCONE_TEST_CONFLICT_DATABASE__POOL_SIZE", "64");
+    setEnvironmentVariable("FIGCONE_TEST_CONFLICT_DATABASE__POOLSIZE", "32");
+    auto overlay = figcone::ConfigOverlay{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                overlay.addEnvironment("FIGCONE_TEST_CONFLICT_");
+            },
+            [](const figcone::ConfigError& error)
+            {
+                const auto message = std::string{error.what()};
+                EXPECT_EQ(message.rfind("Overlay fields override the same config field: ", 0), 0);
+                EXPECT_NE(message.find("'FIGCONE_TEST_CONFLICT_DATABASE__POOL_SIZE'"), std::string::npos);
+                EXPECT_NE(message.find("'FIGCONE_TEST_CONFLICT_DATABASE__POOLSIZE'"), std::string::npos);
+            });
+}
+
+TEST(TestConfigOverlay, ConflictingParamAndNodeError)
+{
+    const char* argv[] = {"app", "--database=local", "--database.host=localhost"};
+    auto overlay = figcone::ConfigOverlay{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                overlay.addCommandLine(3, argv);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Overlay fields override the same config field: Command line argument '--database=local', "
+                        "Command line argument '--database.host=localhost'");
+            });
+}
+
+TEST(TestConfigOverlay, RepeatedCommandLineArgumentOverridesEarlierOne)
+{
+    const char* argv[] = {"app", "--database.poolSize=16", "--database.poolSize=32"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addCommandLine(3, argv);
+
+    auto parser = TreeProvider{makeTree()};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.database.poolSize, 32);
+}
+
+} //namespace test_configoverlay
\ No newline at end of file
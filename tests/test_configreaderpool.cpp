@@ -0,0 +1,132 @@
+#include <figcone/config.h>
+#include <figcone/configreaderpool.h>
+#include <figcone/errors.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_configreaderpool {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(value, int);
+};
+
+std::atomic<int> parserCount = 0;
+
+//parses configs with a "name=value" field on each line, fails if it's used by multiple threads at the same time
+class Parser : public figcone::IParser {
+public:
+    Parser()
+    {
+        ++parserCount;
+    }
+
+    figcone::Tree parse(std::istream& stream) override
+    {
+        if (isParsing_.exchange(true))
+            throw figcone::ConfigError{"Parser is used concurrently"};
+
+        auto tree = figcone::makeTreeRoot();
+        auto line = std::string{};
+        auto lineNumber = 0;
+        while (std::getline(stream, line)) {
+            ++lineNumber;
+            const auto delimPos = line.find('=');
+            if (delimPos != std::string::npos)
+                tree->asItem().addParam(line.substr(0, delimPos), line.substr(delimPos + 1), {lineNumber, 1});
+        }
+        isParsing_ = false;
+        return tree;
+    }
+
+private:
+    std::atomic<bool> isParsing_ = false;
+};
+
+class TestConfigReaderPool : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        parserCount = 0;
+    }
+
+    figcone::ConfigReaderPool readerPool_{[]
+                                          {
+                                              return std::make_unique<Parser>();
+                                          }};
+};
+
+TEST_F(TestConfigReaderPool, ReaderIsReused)
+{
+    for (auto i = 0; i < 10; ++i) {
+        auto cfg = readerPool_.read<Cfg>("name=flag\nvalue=" + std::to_string(i));
+        EXPECT_EQ(cfg.name, "flag");
+        EXPECT_EQ(cfg.value, i);
+    }
+    EXPECT_EQ(parserCount, 1);
+}
+
+TEST_F(TestConfigReaderPool, LeasedReaderIsNotShared)
+{
+    {
+        auto lease = readerPool_.acquire();
+        auto otherLease = readerPool_.acquire();
+        EXPECT_NE(&lease.reader(), &otherLease.reader());
+        EXPECT_NE(&lease.parser(), &otherLease.parser());
+        EXPECT_EQ(lease.read<Cfg>("name=first\nvalue=1").name, "first");
+        EXPECT_EQ(otherLease.read<Cfg>("name=second\nvalue=2").name, "second");
+    }
+    EXPECT_EQ(parserCount, 2);
+
+    auto cfg = readerPool_.read<Cfg>("name=third\nvalue=3");
+    EXPECT_EQ(cfg.name, "third");
+    EXPECT_EQ(parserCount, 2);
+}
+
+TEST_F(TestConfigReaderPool, ReaderIsUsableAfterError)
+{
+    EXPECT_THROW(readerPool_.read<Cfg>("name=flag\nvalue=on"), figcone::ConfigError);
+    EXPECT_THROW(readerPool_.read<Cfg>("name=flag"), figcone::ConfigError);
+
+    auto cfg = readerPool_.read<Cfg>("name=flag\nvalue=1");
+    EXPECT_EQ(cfg.name, "flag");
+    EXPECT_EQ(cfg.value, 1);
+    EXPECT_EQ(parserCount, 1);
+}
+
+TEST_F(TestConfigReaderPool, ConcurrentReads)
+{
+    constexpr auto threadCount = 4;
+    auto errorCount = std::atomic<int>{};
+    auto threads = std::vector<std::thread>{};
+    for (auto threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        threads.emplace_back(
+                [&, threadIndex]
+                {
+                    for (auto i = 0; i < 1000; ++i) {
+                        const auto value = threadIndex * 1000 + i;
+                        try {
+                            const auto cfg = readerPool_.read<Cfg>("name=flag\nvalue=" + std::to_string(value));
+                            if (cfg.value != value)
+                                ++errorCount;
+                        }
+                        catch (const figcone::ConfigError&) {
+                            ++errorCount;
+                        }
+                    }
+                });
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(errorCount, 0);
+    EXPECT_LE(parserCount, threadCount);
+}
+
+} //namespace test_configreaderpool
\ No newline at end of file
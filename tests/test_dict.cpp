@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 #include <map>
 #include <string>
+#include <string_view>
 
 #if __has_include(<figcone/detail/external/nameof.hpp>)
 #define NAMEOF_AVAILABLE
@@ -17,6 +18,24 @@ using StringMap = std::map<std::string, std::string>;
 using StringUnorderedMap = std::map<std::string, std::string>;
 using IntMap = std::map<std::string, int>;
 
+struct Tag {
+    std::string value;
+};
+} //namespace test_dict
+
+template<>
+struct figcone::StringConverter<test_dict::Tag> {
+    static std::optional<test_dict::Tag> fromString(std::string_view data)
+    {
+        if (data.empty())
+            return {};
+        return test_dict::Tag{"#" + std::string{data}};
+    }
+};
+
+namespace test_dict {
+using TagMap = std::map<std::string, Tag>;
+
 struct DictCfg : public figcone::Config {
     FIGCONE_DICT(test, StringMap);
     FIGCONE_DICT(optTest, StringUnorderedMap)();
@@ -27,6 +46,10 @@ struct IntDictCfg : public figcone::Config {
     FIGCONE_DICT(test, IntMap)({{"abc", 11}, {"xyz", 12}});
 };
 
+struct TagDictCfg : public figcone::Config {
+    FIGCONE_DICT(test, TagMap);
+};
+
 struct NonEmptyValidator {
 public:
     template<typename T>
@@ -194,6 +217,26 @@ TEST(TestDict, IntMultiParam)
     EXPECT_EQ(cfg.test["baz"], 777);
 }
 
+TEST(TestDict, StringViewUserTypeMultiParam)
+{
+    ///[[test]]
+    ///  foo = a
+    ///  bar = b
+
+    auto tree = figcone::makeTreeRoot();
+    auto& testNode = tree->asItem().addNode("test", {1, 1}).asItem();
+    testNode.addParam("foo", "a", {2, 3});
+    testNode.addParam("bar", "b", {3, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.read<TagDictCfg>("", parser);
+
+    ASSERT_EQ(cfg.test.size(), 2);
+    EXPECT_EQ(cfg.test["foo"].value, "#a");
+    EXPECT_EQ(cfg.test["bar"].value, "#b");
+}
+
 TEST(TestDict, DefaultValue)
 {
     auto tree = figcone::makeTreeRoot();
@@ -0,0 +1,304 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/listmergemode.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace test_layeredconfig {
+
+struct Db : public figcone::Config {
+    FIGCONE_PARAM(host, std::string);
+    FIGCONE_PARAM(port, int);
+};
+
+struct User : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAMLIST(ports, std::vector<int>)();
+    FIGCONE_NODE(db, Db);
+    FIGCONE_NODELIST(users, std::vector<User>)();
+};
+
+struct CountedCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(level, int);
+};
+
+int postProcessorCallCount = 0;
+
+} //namespace test_layeredconfig
+
+namespace figcone {
+template<>
+void PostProcessor<test_layeredconfig::CountedCfg>::operator()(test_layeredconfig::CountedCfg&)
+{
+    ++test_layeredconfig::postProcessorCallCount;
+}
+} //namespace figcone
+
+namespace test_layeredconfig {
+
+//returns the stored trees in order, one for each parsed layer
+class LayersProvider : public figcone::IParser {
+public:
+    void addLayer(std::unique_ptr<figcone::TreeNode> tree)
+    {
+        layers_.push_back(std::move(tree));
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(layers_.at(layerIndex_++));
+    }
+
+private:
+    std::vector<std::unique_ptr<figcone::TreeNode>> layers_;
+    std::size_t layerIndex_ = 0;
+};
+
+std::unique_ptr<figcone::TreeNode> makeBaseLayer()
+{
+    ///
+    /// name = base
+    /// ports = [80, 443]
+    /// [db]
+    ///   host = localhost
+    ///   port = 5432
+    /// [[users]]
+    ///   name = admin
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "base", {1, 1});
+    tree->asItem().addParamList("ports", std::vector<std::string>{"80", "443"}, {2, 1});
+    auto& db = tree->asItem().addNode("db", {3, 1});
+    db.asItem().addParam("host", "localhost", {4, 3});
+    db.asItem().addParam("port", "5432", {5, 3});
+    auto& users = tree->asItem().addNodeList("users", {6, 1});
+    users.asList().emplaceBack({7, 3}).asItem().addParam("name", "admin", {7, 3});
+    return tree;
+}
+
+std::unique_ptr<figcone::TreeNode> makeOverrideLayer()
+{
+    ///
+    /// ports = [8080]
+    /// [db]
+    ///   port = 6432
+    /// [[users]]
+    ///   name = guest
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParamList("ports", std::vector<std::string>{"8080"}, {1, 1});
+    auto& db = tree->asItem().addNode("db", {2, 1});
+    db.asItem().addParam("port", "6432", {3, 3});
+    auto& users = tree->asItem().addNodeList("users", {4, 1});
+    users.asList().emplaceBack({5, 3}).asItem().addParam("name", "guest", {5, 3});
+    return tree;
+}
+
+std::vector<std::string> userNames(const Cfg& cfg)
+{
+    auto result = std::vector<std::string>{};
+    for (const auto& user : cfg.users)
+        result.push_back(user.name);
+    return result;
+}
+
+TEST(TestLayeredConfig, LaterLayersOverrideParamsAndMergeNodes)
+{
+    auto parser = LayersProvider{};
+    parser.addLayer(makeBaseLayer());
+    parser.addLayer(makeOverrideLayer());
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayered<Cfg>({"", ""}, parser);
+
+    EXPECT_EQ(cfg.name, "base");
+    EXPECT_EQ(cfg.db.host, "localhost");
+    EXPECT_EQ(cfg.db.port, 6432);
+}
+
+TEST(TestLayeredConfig, ListsAreReplaced)
+{
+    auto parser = LayersProvider{};
+    parser.addLayer(makeBaseLayer());
+    parser.addLayer(makeOverrideLayer());
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayered<Cfg>({"", ""}, parser, figcone::ListMergeMode::Replace);
+
+    EXPECT_EQ(cfg.ports, (std::vector<int>{8080}));
+    EXPECT_EQ(userNames(cfg), (std::vector<std::string>{"guest"}));
+}
+
+TEST(TestLayeredConfig, ListsAreAppended)
+{
+    auto parser = LayersProvider{};
+    parser.addLayer(makeBaseLayer());
+    parser.addLayer(makeOverrideLayer());
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayered<Cfg>({"", ""}, parser, figcone::ListMergeMode::Append);
+
+    EXPECT_EQ(cfg.ports, (std::vector<int>{80, 443, 8080}));
+    EXPECT_EQ(userNames(cfg), (std::vector<std::string>{"admin", "guest"}));
+}
+
+TEST(TestLayeredConfig, FieldKindChangeUsesLaterLayer)
+{
+    ///
+    /// ports = 80
+    ///
+    auto baseTree = figcone::makeTreeRoot();
+    baseTree->asItem().addParam("ports", "80", {1, 1});
+    ///
+    /// name = override
+    /// ports = [81, 82]
+    /// [db]
+    ///   host = localhost
+    ///   port = 5432
+    ///
+    auto overrideTree = figcone::makeTreeRoot();
+    overrideTree->asItem().addParam("name", "override", {1, 1});
+    overrideTree->asItem().addParamList("ports", std::vector<std::string>{"81", "82"}, {2, 1});
+    auto& db = overrideTree->asItem().addNode("db", {3, 1});
+    db.asItem().addParam("host", "localhost", {4, 3});
+    db.asItem().addParam("port", "5432", {5, 3});
+
+    auto parser = LayersProvider{};
+    parser.addLayer(std::move(baseTree));
+    parser.addLayer(std::move(overrideTree));
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayered<Cfg>({"", ""}, parser, figcone::ListMergeMode::Append);
+
+    EXPECT_EQ(cfg.name, "override");
+    EXPECT_EQ(cfg.ports, (std::vector<int>{81, 82}));
+}
+
+TEST(TestLayeredConfig, RequiredParamFromLaterLayerIsBoundOnce)
+{
+    ///
+    /// name = base
+    ///
+    auto baseTree = figcone::makeTreeRoot();
+    baseTree->asItem().addParam("name", "base", {1, 1});
+    ///
+    /// level = 2
+    ///
+    auto overrideTree = figcone::makeTreeRoot();
+    overrideTree->asItem().addParam("level", "2", {1, 1});
+
+    auto parser = LayersProvider{};
+    parser.addLayer(std::move(baseTree));
+    parser.addLayer(std::move(overrideTree));
+
+    postProcessorCallCount = 0;
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayered<CountedCfg>({"", ""}, parser);
+
+    EXPECT_EQ(cfg.name, "base");
+    EXPECT_EQ(cfg.level, 2);
+    EXPECT_EQ(postProcessorCallCount, 1);
+}
+
+TEST(TestLayeredConfig, MissingParamInAllLayersError)
+{
+    ///
+    /// name = base
+    ///
+    auto baseTree = figcone::makeTreeRoot();
+    baseTree->asItem().addParam("name", "base", {1, 1});
+    ///
+    /// name = override
+    ///
+    auto overrideTree = figcone::makeTreeRoot();
+    overrideTree->asItem().addParam("name", "override", {1, 1});
+
+    auto parser = LayersProvider{};
+    parser.addLayer(std::move(baseTree));
+    parser.addLayer(std::move(overrideTree));
+
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayered<CountedCfg>({"", ""}, parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:1, column:1] Root node: Parameter 'level' is missing.");
+            });
+}
+
+TEST(TestLayeredConfig, RootListLayerError)
+{
+    auto parser = LayersProvider{};
+    parser.addLayer(makeBaseLayer());
+    parser.addLayer(figcone::makeTreeRootList());
+
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readLayered<Cfg>({"", ""}, parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Config layers with a list at the root level can't be merged");
+            });
+}
+
+//parses configs in the "name=value" format containing a single parameter
+class Parser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        auto tree = figcone::makeTreeRoot();
+        const auto delimPos = config.find('=');
+        if (delimPos != std::string::npos)
+            tree->asItem().addParam(config.substr(0, delimPos), config.substr(delimPos + 1), {1, 1});
+        return tree;
+    }
+};
+
+TEST(TestLayeredConfig, LayeredFiles)
+{
+    const auto configDir = std::filesystem::temp_directory_path() / "figcone_test_layeredconfig";
+    std::filesystem::create_directories(configDir);
+    auto writeConfig = [&](const std::string& name, const std::string& config)
+    {
+        const auto configFile = configDir / name;
+        auto stream = std::ofstream{configFile, std::ios_base::binary};
+        stream << config;
+        return configFile;
+    };
+    const auto configFiles = std::vector<std::filesystem::path>{
+            writeConfig("base", "name=base"),
+            writeConfig("override", "level=3")};
+
+    auto parser = Parser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readLayeredFiles<CountedCfg>(configFiles, parser);
+    std::filesystem::remove_all(configDir);
+
+    EXPECT_EQ(cfg.name, "base");
+    EXPECT_EQ(cfg.level, 3);
+}
+
+} //namespace test_layeredconfig
\ No newline at end of file
@@ -213,4 +213,32 @@ TEST(NameFormat, CamelStructKebabCfg)
     EXPECT_EQ(cfg.testInner.testStr, "Hello");
 }
 
+
+struct InnerWithoutMacroCfg : public figcone::Config {
+    std::string testStr = param<&InnerWithoutMacroCfg::testStr>("testStr");
+};
+
+struct WithoutMacroCfg : public figcone::Config {
+    int testInt = param<&WithoutMacroCfg::testInt>("testInt");
+    InnerWithoutMacroCfg testInner = node<&WithoutMacroCfg::testInner>(std::string{"testInner"});
+};
+
+TEST(NameFormat, WithoutMacroSnakeCfg)
+{
+    ///test_int = 10
+    ///#test_inner:
+    ///  test_str = Hello
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("test_int", "10", {1, 1});
+    auto& node = tree->asItem().addNode("test_inner", {2, 1});
+    node.asItem().addParam("test_str", "Hello", {3, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::SnakeCase};
+    auto cfg = cfgReader.read<WithoutMacroCfg>("", parser);
+    EXPECT_EQ(cfg.testInt, 10);
+    EXPECT_EQ(cfg.testInner.testStr, "Hello");
+}
+
 } //namespace test_nameformat
\ No newline at end of file
@@ -7,6 +7,11 @@
 
 #include <deque>
 #include <list>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
 
 #if __has_include(<figcone/detail/external/nameof.hpp>)
 #define NAMEOF_AVAILABLE
@@ -791,4 +796,253 @@ TEST(TestNodeList, IncompleteListElementError)
             });
 }
 
+TEST(TestNodeList, IncompleteSecondListElementError)
+{
+    ///testStr = Hello
+    ///[[testNodes]]
+    ///    testInt = 2
+    ///[[testNodes]]
+
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {2, 1});
+    {
+        auto& node = testNodes.asList().emplaceBack({2, 1});
+        node.asItem().addParam("testInt", "2", {3, 3});
+    }
+    testNodes.asList().emplaceBack({4, 1});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<Cfg>("", parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:4, column:1] Node list 'testNodes': Parameter 'testInt' is missing.");
+            });
+}
+
+TEST(TestNodeList, ParallelBinding)
+{
+    ///testStr = Hello
+    ///[[testNodes]]
+    ///  testInt = 0
+    ///...
+    ///[[testNodes]]
+    ///  testInt = 99
+    ///[[optTestNodes]]
+    ///  testInt = 0
+    ///...
+    ///[[optTestNodes]]
+    ///  testInt = 99
+
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {2, 1});
+    auto& optTestNodes = tree->asItem().addNodeList("optTestNodes", {202, 1});
+    for (auto i = 0; i < 100; ++i) {
+        auto& node = testNodes.asList().emplaceBack({2 + i * 2, 1});
+        node.asItem().addParam("testInt", std::to_string(i), {3 + i * 2, 3});
+        auto& optNode = optTestNodes.asList().emplaceBack({202 + i * 2, 1});
+        optNode.asItem().addParam("testInt", std::to_string(i), {203 + i * 2, 3});
+    }
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::NodeListParallelism{4, 1}};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    ASSERT_EQ(cfg.testNodes.size(), 100);
+    ASSERT_EQ(cfg.optTestNodes.size(), 100);
+    auto optTestNodeIt = cfg.optTestNodes.begin();
+    for (auto i = 0; i < 100; ++i, ++optTestNodeIt) {
+        EXPECT_EQ(cfg.testNodes.at(i).testInt, i);
+        EXPECT_EQ(optTestNodeIt->testInt, i);
+    }
+    EXPECT_EQ(cfg.testStr, "Hello");
+}
+
+TEST(TestNodeList, ParallelBindingReportsFirstInvalidListElement)
+{
+    ///[[testNodes]]
+    ///  testInt = 0
+    ///...
+    ///[[testNodes]]
+    ///  testInt = error
+    ///...
+    ///[[testNodes]]
+    ///  testInt = 99
+
+    auto makeTree = []
+    {
+        auto tree = figcone::makeTreeRoot();
+        tree->asItem().addParam("testStr", "Hello", {1, 1});
+        auto& testNodes = tree->asItem().addNodeList("testNodes", {2, 1});
+        for (auto i = 0; i < 100; ++i) {
+            auto& node = testNodes.asList().emplaceBack({2 + i * 2, 1});
+            if (i == 30 || i == 80)
+                continue;
+            node.asItem().addParam("testInt", i == 40 ? "error" : std::to_string(i), {3 + i * 2, 3});
+        }
+        return tree;
+    };
+
+    auto readError = [&](figcone::NodeListParallelism parallelism)
+    {
+        auto parser = TreeProvider{makeTree()};
+        auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, parallelism};
+        try {
+            cfgReader.read<Cfg>("", parser);
+        }
+        catch (const figcone::ConfigError& error) {
+            return std::string{error.what()};
+        }
+        return std::string{};
+    };
+
+    const auto expectedError =
+            std::string{"[line:62, column:1] Node list 'testNodes': Parameter 'testInt' is missing."};
+    EXPECT_EQ(readError(figcone::NodeListParallelism{}), expectedError);
+    for (auto threadCount : {2, 3, 4, 8})
+        EXPECT_EQ(readError(figcone::NodeListParallelism{threadCount, 1}), expectedError);
+}
+
+TEST(TestNodeList, ParallelBindingOfRootList)
+{
+    ///testInt = 0
+    ///---
+    ///...
+    ///---
+    ///testInt = 99
+
+    auto tree = figcone::makeTreeRootList();
+    for (auto i = 0; i < 100; ++i) {
+        auto& node = tree->asList().emplaceBack({1 + i * 2, 1});
+        node.asItem().addParam("testInt", std::to_string(i), {1 + i * 2, 1});
+    }
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::NodeListParallelism{4, 1}};
+    auto cfgList = cfgReader.read<Node, figcone::RootType::NodeList>("", parser);
+
+    ASSERT_EQ(cfgList.size(), 100);
+    for (auto i = 0; i < 100; ++i)
+        EXPECT_EQ(cfgList.at(i).testInt, i);
+}
+
+TEST(TestNodeList, ParallelBindingOfRootListReportsFirstInvalidElement)
+{
+    ///testInt = 0
+    ///---
+    ///...
+    ///---
+    ///testInt = 99
+
+    auto makeTree = []
+    {
+        auto tree = figcone::makeTreeRootList();
+        for (auto i = 0; i < 100; ++i) {
+            auto& node = tree->asList().emplaceBack({1 + i * 2, 1});
+            if (i == 30 || i == 80)
+                continue;
+            node.asItem().addParam("testInt", i == 40 ? "error" : std::to_string(i), {1 + i * 2, 1});
+        }
+        return tree;
+    };
+
+    auto readError = [&](figcone::NodeListParallelism parallelism)
+    {
+        auto parser = TreeProvider{makeTree()};
+        auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, parallelism};
+        try {
+            cfgReader.read<Node, figcone::RootType::NodeList>("", parser);
+        }
+        catch (const figcone::ConfigError& error) {
+            return std::string{error.what()};
+        }
+        return std::string{};
+    };
+
+    const auto expectedError = readError(figcone::NodeListParallelism{});
+    EXPECT_EQ(expectedError, "[line:61, column:1] Root node: Parameter 'testInt' is missing.");
+    for (auto threadCount : {2, 3, 4, 8})
+        EXPECT_EQ(readError(figcone::NodeListParallelism{threadCount, 1}), expectedError);
+}
+
+
+//stores the threads loading the parameters of this type
+struct ThreadRecordingInt {
+    int value;
+};
+
+std::mutex loadingThreadsMutex;
+std::set<std::thread::id> loadingThreads;
+
+struct ThreadRecordingNode : public figcone::Config {
+    FIGCONE_PARAM(testInt, ThreadRecordingInt);
+};
+
+struct OuterNode : public figcone::Config {
+    FIGCONE_NODELIST(innerNodes, std::vector<ThreadRecordingNode>);
+};
+
+struct NestedListCfg : public figcone::Config {
+    FIGCONE_NODELIST(outerNodes, std::vector<OuterNode>);
+};
+
+} //namespace test_nodelist
+
+template<>
+struct figcone::StringConverter<test_nodelist::ThreadRecordingInt> {
+    static std::optional<test_nodelist::ThreadRecordingInt> fromString(const std::string& data)
+    {
+        {
+            auto lock = std::lock_guard{test_nodelist::loadingThreadsMutex};
+            test_nodelist::loadingThreads.insert(std::this_thread::get_id());
+        }
+        return test_nodelist::ThreadRecordingInt{std::stoi(data)};
+    }
+};
+
+namespace test_nodelist {
+
+TEST(TestNodeList, ParallelBindingOfNestedListsDoesntStartMoreWorkers)
+{
+    ///[[outerNodes]]
+    ///  [[outerNodes.innerNodes]]
+    ///    testInt = 0
+    ///  ...
+    ///  [[outerNodes.innerNodes]]
+    ///    testInt = 49
+    ///...
+
+    auto tree = figcone::makeTreeRoot();
+    auto& outerNodes = tree->asItem().addNodeList("outerNodes", {1, 1});
+    for (auto i = 0; i < 4; ++i) {
+        auto& outerNode = outerNodes.asList().emplaceBack({1, 1});
+        auto& innerNodes = outerNode.asItem().addNodeList("innerNodes", {1, 1});
+        for (auto j = 0; j < 50; ++j) {
+            auto& innerNode = innerNodes.asList().emplaceBack({1, 1});
+            innerNode.asItem().addParam("testInt", std::to_string(j), {1, 1});
+        }
+    }
+
+    loadingThreads.clear();
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::NodeListParallelism{4, 1}};
+    auto cfg = cfgReader.read<NestedListCfg>("", parser);
+
+    ASSERT_EQ(cfg.outerNodes.size(), 4);
+    for (const auto& outerNode : cfg.outerNodes) {
+        ASSERT_EQ(outerNode.innerNodes.size(), 50);
+        for (auto j = 0; j < 50; ++j)
+            EXPECT_EQ(outerNode.innerNodes.at(j).testInt.value, j);
+    }
+    EXPECT_LE(loadingThreads.size(), 4);
+}
+
 } //namespace test_nodelist
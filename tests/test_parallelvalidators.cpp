@@ -0,0 +1,237 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/validatorparallelism.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace test_parallelvalidators {
+
+std::atomic<int> runningValidatorCount = 0;
+std::atomic<int> maxRunningValidatorCount = 0;
+std::atomic<bool> isWaitingTimedOut = false;
+std::mutex threadIdsMutex;
+std::set<std::thread::id> threadIds;
+
+//waits until the expected number of validators are running at the same time, or until the timeout
+void waitForValidators(int expectedCount)
+{
+    {
+        auto lock = std::lock_guard{threadIdsMutex};
+        threadIds.insert(std::this_thread::get_id());
+    }
+    const auto runningCount = ++runningValidatorCount;
+    auto maxRunningCount = maxRunningValidatorCount.load();
+    while (runningCount > maxRunningCount &&
+           !maxRunningValidatorCount.compare_exchange_weak(maxRunningCount, runningCount)) {
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (maxRunningValidatorCount < expectedCount) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            isWaitingTimedOut = true;
+            break;
+        }
+        std::this_thread::yield();
+    }
+    --runningValidatorCount;
+}
+
+struct Node : public figcone::Config {
+    FIGCONE_PARAM(a, int).ensure(
+            [](int)
+            {
+                waitForValidators(5);
+            });
+    FIGCONE_PARAM(b, int).ensure(
+            [](int)
+            {
+                waitForValidators(5);
+            });
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(a, int).ensure(
+            [](int)
+            {
+                waitForValidators(5);
+            });
+    FIGCONE_PARAM(b, int).ensure(
+            [](int)
+            {
+                waitForValidators(5);
+            });
+    FIGCONE_PARAM(c, int).ensure(
+            [](int)
+            {
+                waitForValidators(5);
+            });
+    FIGCONE_NODE(nested, Node);
+};
+
+struct SequentialCfg : public figcone::Config {
+    FIGCONE_PARAM(a, int).ensure(
+            [](int)
+            {
+                waitForValidators(1);
+            });
+    FIGCONE_PARAM(b, int).ensure(
+            [](int)
+            {
+                waitForValidators(1);
+            });
+    FIGCONE_PARAM(c, int).ensure(
+            [](int)
+            {
+                waitForValidators(1);
+            });
+};
+
+struct FailingCfg : public figcone::Config {
+    FIGCONE_PARAM(a, int);
+    FIGCONE_PARAM(b, int).ensure(
+            [](int)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds{50});
+                throw figcone::ValidationError{"slow error"};
+            });
+    FIGCONE_PARAM(c, int);
+    FIGCONE_PARAM(d, int).ensure(
+            [](int)
+            {
+                throw figcone::ValidationError{"fast error"};
+            });
+};
+
+struct FailingNode : public figcone::Config {
+    FIGCONE_PARAM(a, int).ensure(
+            [](int)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds{50});
+                throw figcone::ValidationError{"slow error"};
+            });
+};
+
+struct FailingNestedCfg : public figcone::Config {
+    FIGCONE_PARAM(a, int).ensure(
+            [](int)
+            {
+                throw figcone::ValidationError{"fast error"};
+            });
+    FIGCONE_NODE(nested, FailingNode);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    explicit TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+private:
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+//creates a tree with the parameters a = 1, b = 2, ... and optionally with the same nested node
+std::unique_ptr<figcone::TreeNode> makeTree(int paramCount, int nestedNodeParamCount = 0)
+{
+    auto addParams = [](figcone::TreeNode& node, int count, int line)
+    {
+        for (auto i = 0; i < count; ++i)
+            node.asItem().addParam(std::string(1, static_cast<char>('a' + i)), std::to_string(i + 1), {line + i, 1});
+    };
+
+    auto tree = figcone::makeTreeRoot();
+    addParams(*tree, paramCount, 1);
+    if (nestedNodeParamCount)
+        addParams(tree->asItem().addNode("nested", {paramCount + 1, 1}), nestedNodeParamCount, paramCount + 2);
+    return tree;
+}
+
+class TestParallelValidators : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        runningValidatorCount = 0;
+        maxRunningValidatorCount = 0;
+        isWaitingTimedOut = false;
+        threadIds.clear();
+    }
+};
+
+TEST_F(TestParallelValidators, ValidatorsAreCalledConcurrently)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setValidatorParallelism(figcone::ValidatorParallelism{8});
+    auto parser = TreeProvider{makeTree(3, 2)};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+    EXPECT_EQ(cfg.c, 3);
+    EXPECT_EQ(cfg.nested.b, 2);
+    //the validators of the root and the nested node are called together after the whole config is loaded
+    EXPECT_FALSE(isWaitingTimedOut);
+    EXPECT_EQ(maxRunningValidatorCount, 5);
+    EXPECT_GT(threadIds.size(), 1);
+}
+
+TEST_F(TestParallelValidators, ValidatorsAreCalledSequentiallyByDefault)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    auto parser = TreeProvider{makeTree(3)};
+    auto cfg = cfgReader.read<SequentialCfg>("", parser);
+    EXPECT_EQ(cfg.c, 3);
+    EXPECT_EQ(maxRunningValidatorCount, 1);
+    EXPECT_EQ(threadIds, (std::set<std::thread::id>{std::this_thread::get_id()}));
+}
+
+TEST_F(TestParallelValidators, FirstFailedValidatorIsReported)
+{
+    for (auto threadCount : {1, 2, 3, 4}) {
+        auto cfgReader = figcone::ConfigReader{};
+        cfgReader.setValidatorParallelism(figcone::ValidatorParallelism{threadCount});
+        auto parser = TreeProvider{makeTree(4)};
+        assert_exception<figcone::ConfigError>(
+                [&]
+                {
+                    cfgReader.read<FailingCfg>("", parser);
+                },
+                [](const figcone::ConfigError& error)
+                {
+                    EXPECT_EQ(std::string{error.what()}, "[line:2, column:1] Parameter 'b': slow error");
+                });
+    }
+}
+
+TEST_F(TestParallelValidators, FirstFailedNestedValidatorIsReported)
+{
+    for (auto threadCount : {1, 2, 3, 4}) {
+        auto cfgReader = figcone::ConfigReader{};
+        cfgReader.setValidatorParallelism(figcone::ValidatorParallelism{threadCount});
+        auto parser = TreeProvider{makeTree(1, 1)};
+        //the nested node is validated after it's loaded, before the validators of the root node are called
+        assert_exception<figcone::ConfigError>(
+                [&]
+                {
+                    cfgReader.read<FailingNestedCfg>("", parser);
+                },
+                [](const figcone::ConfigError& error)
+                {
+                    EXPECT_EQ(std::string{error.what()}, "[line:3, column:1] Parameter 'a': slow error");
+                });
+    }
+}
+
+} //namespace test_parallelvalidators
\ No newline at end of file
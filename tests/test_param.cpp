@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <filesystem>
 #include <optional>
+#include <string_view>
 
 #if __has_include(<figcone/detail/external/nameof.hpp>)
 #define NAMEOF_AVAILABLE
@@ -75,9 +76,24 @@ struct MultiParamCfg : public figcone::Config {
     FIGCONE_PARAM(testString2, figcone::optional<std::string>);
 };
 
+struct NumericParamCfg : public figcone::Config {
+    FIGCONE_PARAM(testInt, int);
+    FIGCONE_PARAM(testUnsigned, unsigned int);
+    FIGCONE_PARAM(testLongLong, long long);
+    FIGCONE_PARAM(testDouble, double);
+    FIGCONE_PARAM(testFloat, float);
+    FIGCONE_PARAM(testBool, bool);
+    FIGCONE_PARAM(testOptInt, std::optional<int>);
+};
+
 struct UserType {
     std::string value;
 };
+
+struct StringViewUserType {
+    std::string value;
+    bool isReadFromStringView = false;
+};
 } //namespace test_param
 
 template<>
@@ -90,11 +106,33 @@ struct figcone::StringConverter<test_param::UserType> {
     }
 };
 
+template<>
+struct figcone::StringConverter<test_param::StringViewUserType> {
+    static std::optional<test_param::StringViewUserType> fromString(const std::string& data)
+    {
+        auto result = test_param::StringViewUserType{};
+        result.value = data;
+        return result;
+    }
+
+    static std::optional<test_param::StringViewUserType> fromString(std::string_view data)
+    {
+        auto result = test_param::StringViewUserType{};
+        result.value = data;
+        result.isReadFromStringView = true;
+        return result;
+    }
+};
+
 namespace test_param {
 struct SingleUserTypeParamCfg : public figcone::Config {
     FIGCONE_PARAM(test, UserType);
 };
 
+struct StringViewUserTypeParamCfg : public figcone::Config {
+    FIGCONE_PARAM(test, StringViewUserType);
+};
+
 class TreeProvider : public figcone::IParser {
 public:
     TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
@@ -165,6 +203,20 @@ TEST(TestParam, UserTypeParam)
     EXPECT_EQ(cfg.test.value, "hello world");
 }
 
+TEST(TestParam, StringViewUserTypeParam)
+{
+    ///test='hello world'
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("test", "hello world", {1, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    auto cfg = cfgReader.read<StringViewUserTypeParamCfg>("", parser);
+
+    EXPECT_EQ(cfg.test.value, "hello world");
+    EXPECT_TRUE(cfg.test.isReadFromStringView);
+}
+
 TEST(TestParam, EmptyStringParam)
 {
     ///test=''
@@ -366,6 +418,65 @@ TEST(TestParam, ParamWrongTypeError)
             });
 }
 
+TEST(TestParam, NumericParam)
+{
+    ///testInt = -42
+    ///testUnsigned = +7
+    ///testLongLong = 9000000000
+    ///testDouble = 1.5e3
+    ///testFloat = -0.25
+    ///testBool = 1
+    ///testOptInt = 007
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testInt", "-42", {1, 1});
+    tree->asItem().addParam("testUnsigned", "+7", {2, 1});
+    tree->asItem().addParam("testLongLong", "9000000000", {3, 1});
+    tree->asItem().addParam("testDouble", "1.5e3", {4, 1});
+    tree->asItem().addParam("testFloat", "-0.25", {5, 1});
+    tree->asItem().addParam("testBool", "1", {6, 1});
+    tree->asItem().addParam("testOptInt", "007", {7, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    auto cfg = cfgReader.read<NumericParamCfg>("", parser);
+
+    EXPECT_EQ(cfg.testInt, -42);
+    EXPECT_EQ(cfg.testUnsigned, 7u);
+    EXPECT_EQ(cfg.testLongLong, 9000000000LL);
+    EXPECT_EQ(cfg.testDouble, 1500.0);
+    EXPECT_EQ(cfg.testFloat, -0.25f);
+    EXPECT_EQ(cfg.testBool, true);
+    EXPECT_EQ(cfg.testOptInt, 7);
+}
+
+void testParamValueError(const std::string& value)
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("test", value, {1, 1});
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<SingleParamCfg>("", parser);
+            },
+            [&](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'test' value from '" + value + "'");
+            });
+}
+
+TEST(TestParam, NumericParamWrongValueError)
+{
+    testParamValueError("1abc");
+    testParamValueError("1.5");
+    testParamValueError("99999999999");
+    testParamValueError("0x10");
+    testParamValueError("");
+}
+
 TEST(TestParam, UnkownParamError)
 {
     ///foo = 1
@@ -0,0 +1,576 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/detail/viewstreambuf.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/ibufferparser.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test_readfile {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(test, std::string);
+};
+
+struct IntCfg : public figcone::Config {
+    FIGCONE_PARAM(test, int);
+};
+
+struct AnotherCfg : public figcone::Config {
+    FIGCONE_PARAM(test, std::string);
+};
+
+int validationCount = 0;
+bool isValidationFailing = false;
+
+struct ValidatedCfg : public figcone::Config {
+    FIGCONE_PARAM(test, std::string)
+            .ensure(
+                    [](const std::string&)
+                    {
+                        ++validationCount;
+                        if (isValidationFailing)
+                            throw figcone::ValidationError{"invalid value"};
+                    });
+};
+
+int defaultCount = 1;
+
+struct DefaultValueCfg : public figcone::Config {
+    FIGCONE_PARAM(test, std::string);
+    FIGCONE_PARAM(count, int)(defaultCount);
+};
+
+struct PostProcessedCfg : public figcone::Config {
+    using Config::Config;
+    FIGCONE_PARAM(test, std::string);
+    std::string greeting;
+};
+
+struct UserValue {
+    std::string value;
+};
+
+int userValueConversionCount = 0;
+
+struct UserValueCfg : public figcone::Config {
+    FIGCONE_PARAM(test, UserValue);
+};
+
+using StringMap = std::map<std::string, std::string>;
+
+struct ElementCfg : public figcone::Config {
+    FIGCONE_PARAM(value, int);
+};
+
+struct NestedCfg : public figcone::Config {
+    FIGCONE_PARAM(number, int);
+    FIGCONE_PARAM(ratio, double);
+    FIGCONE_PARAM(optNumber, figcone::optional<int>);
+    FIGCONE_PARAMLIST(names, std::vector<std::string>);
+    FIGCONE_NODE(element, ElementCfg);
+    FIGCONE_NODE(optElement, figcone::optional<ElementCfg>);
+    FIGCONE_NODELIST(elements, std::vector<ElementCfg>);
+    FIGCONE_DICT(tags, StringMap);
+};
+
+} //namespace test_readfile
+
+template<>
+struct figcone::StringConverter<test_readfile::UserValue> {
+    static std::optional<test_readfile::UserValue> fromString(const std::string& data)
+    {
+        ++test_readfile::userValueConversionCount;
+        return test_readfile::UserValue{data};
+    }
+};
+
+template<>
+void figcone::PostProcessor<test_readfile::PostProcessedCfg>::operator()(test_readfile::PostProcessedCfg& cfg)
+{
+    cfg.test += "!";
+    cfg.greeting = "Hello, " + cfg.test;
+}
+
+namespace test_readfile {
+
+//parses configs in the "name=value" format containing a single parameter
+figcone::Tree parseSingleParam(std::string_view config)
+{
+    auto tree = figcone::makeTreeRoot();
+    const auto delimPos = config.find('=');
+    if (delimPos != std::string_view::npos)
+        tree->asItem().addParam(
+                std::string{config.substr(0, delimPos)},
+                std::string{config.substr(delimPos + 1)},
+                {1, 1});
+    return tree;
+}
+
+class StreamParser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        ++streamParseCount;
+        isFileStreamParsed = dynamic_cast<std::ifstream*>(&stream) != nullptr;
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        return parseSingleParam(config);
+    }
+
+    int streamParseCount = 0;
+    bool isFileStreamParsed = false;
+};
+
+class BufferParser : public StreamParser,
+                     public figcone::IBufferParser {
+public:
+    using StreamParser::parse;
+
+    figcone::Tree parse(std::string_view buffer) override
+    {
+        ++bufferParseCount;
+        return parseSingleParam(buffer);
+    }
+
+    int bufferParseCount = 0;
+};
+
+class NestedCfgParser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream&) override
+    {
+        ++parseCount;
+        auto tree = figcone::makeTreeRoot();
+        auto& root = tree->asItem();
+        root.addParam("number", "-42");
+        root.addParam("ratio", "0.1");
+        root.addParamList("names", {"a", "b"});
+        root.addNode("element").asItem().addParam("value", "1");
+        auto& elements = root.addNodeList("elements").asList();
+        elements.emplaceBack().asItem().addParam("value", "2");
+        elements.emplaceBack().asItem().addParam("value", "3");
+        root.addNode("tags").asItem().addParam("key", "value");
+        return tree;
+    }
+
+    int parseCount = 0;
+};
+
+class TestReadFile : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto testName = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+        configFile_ = std::filesystem::temp_directory_path() / ("figcone_test_readfile_" + testName);
+        snapshotFile_ = std::filesystem::temp_directory_path() / ("figcone_test_readfile_snapshot_" + testName);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(configFile_);
+        std::filesystem::remove(snapshotFile_);
+    }
+
+    void writeConfig(const std::string& config)
+    {
+        auto stream = std::ofstream{configFile_, std::ios_base::binary};
+        stream << config;
+    }
+
+    std::filesystem::path configFile_;
+    std::filesystem::path snapshotFile_;
+};
+
+TEST_F(TestReadFile, BufferParser)
+{
+    writeConfig("test=hello world");
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFileMapped<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 1);
+    EXPECT_EQ(parser.streamParseCount, 0);
+}
+
+TEST_F(TestReadFile, BufferParserReadsFileStreamByDefault)
+{
+    writeConfig("test=hello world");
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 0);
+    EXPECT_EQ(parser.streamParseCount, 1);
+    EXPECT_TRUE(parser.isFileStreamParsed);
+}
+
+TEST_F(TestReadFile, StreamParser)
+{
+    writeConfig("test=hello world");
+    auto parser = StreamParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.streamParseCount, 1);
+}
+
+TEST_F(TestReadFile, StreamParserReadsFromFileStream)
+{
+    writeConfig("test=hello world");
+    auto parser = StreamParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_TRUE(parser.isFileStreamParsed);
+}
+
+TEST_F(TestReadFile, StreamParserDoesntReadMappedFile)
+{
+    writeConfig("test=hello world");
+    auto parser = StreamParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFileMapped<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.streamParseCount, 1);
+    EXPECT_TRUE(parser.isFileStreamParsed);
+}
+
+TEST_F(TestReadFile, ViewStreamIsSeekable)
+{
+    auto parser = StreamParser{};
+    auto buffer = std::string_view{"xxtest=hello world"};
+    auto streamBuf = figcone::detail::ViewStreamBuf{buffer};
+    auto stream = std::istream{&streamBuf};
+    stream.seekg(0, std::ios_base::end);
+    EXPECT_EQ(stream.tellg(), static_cast<std::streamoff>(buffer.size()));
+    stream.seekg(2);
+    EXPECT_EQ(stream.tellg(), 2);
+
+    auto tree = parser.parse(stream);
+    EXPECT_EQ(tree.root().asItem().param("test").value(), "hello world");
+}
+
+#ifdef FIGCONE_JSON_AVAILABLE
+TEST_F(TestReadFile, JsonFile)
+{
+    writeConfig(R"({"test": "hello world"})");
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readJsonFile<Cfg>(configFile_);
+
+    EXPECT_EQ(cfg.test, "hello world");
+}
+#endif
+
+TEST_F(TestReadFile, EmptyFileBufferParser)
+{
+    writeConfig("");
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readFileMapped<Cfg>(configFile_, parser);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:1, column:1] Root node: Parameter 'test' is missing.");
+            });
+    EXPECT_EQ(parser.bufferParseCount, 1);
+}
+
+TEST_F(TestReadFile, MissingFileError)
+{
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readFile<Cfg>(configFile_, parser);
+            },
+            [&](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "Config file " + figcone::eel::to_string(configFile_) + " doesn't exist");
+            });
+}
+
+TEST_F(TestReadFile, SnapshotIsUsedInsteadOfParsing)
+{
+    writeConfig("test=hello world");
+    {
+        auto parser = BufferParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        auto cfg = cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+        EXPECT_EQ(cfg.test, "hello world");
+        EXPECT_EQ(parser.bufferParseCount, 1);
+        EXPECT_TRUE(std::filesystem::exists(snapshotFile_));
+    }
+
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 0);
+    EXPECT_EQ(parser.streamParseCount, 0);
+}
+
+TEST_F(TestReadFile, SnapshotIsIgnoredAfterConfigChange)
+{
+    writeConfig("test=hello world");
+    auto cfgReader = figcone::ConfigReader{};
+    {
+        auto parser = BufferParser{};
+        cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    }
+
+    writeConfig("test=hello snapshot");
+    auto parser = BufferParser{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello snapshot");
+    EXPECT_EQ(parser.bufferParseCount, 1);
+
+    auto secondParser = BufferParser{};
+    cfg = cfgReader.readFile<Cfg>(configFile_, secondParser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello snapshot");
+    EXPECT_EQ(secondParser.bufferParseCount, 0);
+}
+
+TEST_F(TestReadFile, SnapshotIsIgnoredForAnotherParser)
+{
+    writeConfig("test=hello world");
+    auto cfgReader = figcone::ConfigReader{};
+    {
+        auto parser = BufferParser{};
+        cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    }
+
+    auto parser = StreamParser{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.streamParseCount, 1);
+}
+
+TEST_F(TestReadFile, DamagedSnapshotIsIgnored)
+{
+    writeConfig("test=hello world");
+    auto cfgReader = figcone::ConfigReader{};
+    {
+        auto parser = BufferParser{};
+        cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    }
+    const auto snapshotSize = std::filesystem::file_size(snapshotFile_);
+    std::filesystem::resize_file(snapshotFile_, snapshotSize - 1);
+
+    auto parser = BufferParser{};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 1);
+    EXPECT_EQ(std::filesystem::file_size(snapshotFile_), snapshotSize);
+}
+
+TEST_F(TestReadFile, SnapshotIsNotSavedForInvalidConfig)
+{
+    writeConfig("test=hello world");
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readFile<IntCfg>(configFile_, parser, snapshotFile_);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'test' value from 'hello world'");
+            });
+    EXPECT_FALSE(std::filesystem::exists(snapshotFile_));
+}
+
+TEST_F(TestReadFile, SnapshotBindingErrorsMatchParsing)
+{
+    writeConfig("test=hello world");
+    auto cfgReader = figcone::ConfigReader{};
+    {
+        auto parser = BufferParser{};
+        cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    }
+
+    auto readError = [&](const std::filesystem::path& snapshotFile)
+    {
+        auto parser = BufferParser{};
+        try {
+            cfgReader.readFile<IntCfg>(configFile_, parser, snapshotFile);
+        }
+        catch (const figcone::ConfigError& error) {
+            return std::string{error.what()};
+        }
+        return std::string{};
+    };
+    EXPECT_EQ(readError(snapshotFile_), readError(snapshotFile_.string() + "_missing"));
+    EXPECT_FALSE(readError(snapshotFile_).empty());
+}
+
+TEST_F(TestReadFile, SnapshotRestoredConfigIsValidated)
+{
+    writeConfig("test=hello world");
+    validationCount = 0;
+    isValidationFailing = false;
+    {
+        auto parser = BufferParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        cfgReader.readFile<ValidatedCfg>(configFile_, parser, snapshotFile_);
+        EXPECT_EQ(validationCount, 1);
+    }
+
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<ValidatedCfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 0);
+    EXPECT_EQ(validationCount, 2);
+}
+
+TEST_F(TestReadFile, SnapshotValidationErrorIsReportedWithPosition)
+{
+    writeConfig("test=hello world");
+    isValidationFailing = false;
+    {
+        auto parser = BufferParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        cfgReader.readFile<ValidatedCfg>(configFile_, parser, snapshotFile_);
+    }
+
+    isValidationFailing = true;
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.readFile<ValidatedCfg>(configFile_, parser, snapshotFile_);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:1, column:1] Parameter 'test': invalid value");
+            });
+    EXPECT_EQ(parser.bufferParseCount, 1);
+    isValidationFailing = false;
+}
+
+TEST_F(TestReadFile, SnapshotIsIgnoredAfterDefaultValueChange)
+{
+    writeConfig("test=hello world");
+    defaultCount = 1;
+    {
+        auto parser = BufferParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        auto cfg = cfgReader.readFile<DefaultValueCfg>(configFile_, parser, snapshotFile_);
+        EXPECT_EQ(cfg.count, 1);
+    }
+
+    defaultCount = 2;
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<DefaultValueCfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(cfg.count, 2);
+    EXPECT_EQ(parser.bufferParseCount, 1);
+    defaultCount = 1;
+}
+
+TEST_F(TestReadFile, SnapshotRestoredConfigIsPostProcessed)
+{
+    writeConfig("test=world");
+    {
+        auto parser = BufferParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        auto cfg = cfgReader.readFile<PostProcessedCfg>(configFile_, parser, snapshotFile_);
+        EXPECT_EQ(cfg.test, "world!");
+        EXPECT_EQ(cfg.greeting, "Hello, world!");
+    }
+
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<PostProcessedCfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(parser.bufferParseCount, 0);
+    EXPECT_EQ(cfg.test, "world!");
+    EXPECT_EQ(cfg.greeting, "Hello, world!");
+}
+
+TEST_F(TestReadFile, SnapshotRestoresNestedConfig)
+{
+    writeConfig("nested config");
+    {
+        auto parser = NestedCfgParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        cfgReader.readFile<NestedCfg>(configFile_, parser, snapshotFile_);
+        EXPECT_EQ(parser.parseCount, 1);
+    }
+
+    auto parser = NestedCfgParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<NestedCfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(parser.parseCount, 0);
+    EXPECT_EQ(cfg.number, -42);
+    EXPECT_EQ(cfg.ratio, 0.1);
+    EXPECT_FALSE(cfg.optNumber.has_value());
+    EXPECT_EQ(cfg.names, (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(cfg.element.value, 1);
+    EXPECT_FALSE(cfg.optElement.has_value());
+    ASSERT_EQ(cfg.elements.size(), 2);
+    EXPECT_EQ(cfg.elements.at(0).value, 2);
+    EXPECT_EQ(cfg.elements.at(1).value, 3);
+    EXPECT_EQ(cfg.tags, (StringMap{{"key", "value"}}));
+}
+
+TEST_F(TestReadFile, SnapshotOfUnsupportedConfigStoresParsedTree)
+{
+    writeConfig("test=hello world");
+    userValueConversionCount = 0;
+    {
+        auto parser = BufferParser{};
+        auto cfgReader = figcone::ConfigReader{};
+        cfgReader.readFile<UserValueCfg>(configFile_, parser, snapshotFile_);
+        EXPECT_EQ(userValueConversionCount, 1);
+    }
+
+    auto parser = BufferParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFile<UserValueCfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test.value, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 0);
+    EXPECT_EQ(userValueConversionCount, 2);
+}
+
+TEST_F(TestReadFile, SnapshotIsIgnoredForAnotherConfigType)
+{
+    writeConfig("test=hello world");
+    auto cfgReader = figcone::ConfigReader{};
+    {
+        auto parser = BufferParser{};
+        cfgReader.readFile<Cfg>(configFile_, parser, snapshotFile_);
+    }
+
+    auto parser = BufferParser{};
+    auto cfg = cfgReader.readFile<AnotherCfg>(configFile_, parser, snapshotFile_);
+    EXPECT_EQ(cfg.test, "hello world");
+    EXPECT_EQ(parser.bufferParseCount, 1);
+}
+
+} //namespace test_readfile
\ No newline at end of file
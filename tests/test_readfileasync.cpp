@@ -0,0 +1,212 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/executor.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __cpp_impl_coroutine
+#include <coroutine>
+#include <exception>
+#endif
+
+namespace test_readfileasync {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(test, int);
+};
+
+//parses configs in the "name=value" format containing a single parameter
+class Parser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        auto tree = figcone::makeTreeRoot();
+        const auto delimPos = config.find('=');
+        if (delimPos != std::string::npos)
+            tree->asItem().addParam(config.substr(0, delimPos), config.substr(delimPos + 1), {1, 1});
+        return tree;
+    }
+};
+
+//executor storing the tasks until they're run by the test
+class TaskQueue {
+public:
+    figcone::Executor executor()
+    {
+        return [this](std::function<void()> task)
+        {
+            tasks_.push_back(std::move(task));
+        };
+    }
+
+    std::size_t run()
+    {
+        auto tasks = std::move(tasks_);
+        tasks_.clear();
+        for (auto& task : tasks)
+            task();
+        return tasks.size();
+    }
+
+private:
+    std::vector<std::function<void()>> tasks_;
+};
+
+#ifdef __cpp_impl_coroutine
+struct Coroutine {
+    struct promise_type {
+        Coroutine get_return_object()
+        {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+};
+#endif
+
+class TestReadFileAsync : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto testName = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+        configFile_ = std::filesystem::temp_directory_path() / ("figcone_test_readfileasync_" + testName);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(configFile_);
+    }
+
+    void writeConfig(const std::string& config)
+    {
+        auto stream = std::ofstream{configFile_, std::ios_base::binary};
+        stream << config;
+    }
+
+    std::filesystem::path configFile_;
+};
+
+TEST_F(TestReadFileAsync, ConfigIsReadOnExecutor)
+{
+    writeConfig("test=42");
+    auto taskQueue = TaskQueue{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFileAsync<Cfg>(configFile_, std::make_unique<Parser>(), taskQueue.executor());
+    EXPECT_EQ(cfg.wait_for(std::chrono::seconds{0}), std::future_status::timeout);
+
+    EXPECT_EQ(taskQueue.run(), 1);
+    EXPECT_EQ(cfg.get().test, 42);
+}
+
+TEST_F(TestReadFileAsync, DefaultExecutorReadsOnNewThread)
+{
+    writeConfig("test=42");
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgs = std::vector<std::future<Cfg>>{};
+    for (auto i = 0; i < 8; ++i)
+        cfgs.push_back(cfgReader.readFileAsync<Cfg>(configFile_, std::make_unique<Parser>()));
+    for (auto& cfg : cfgs)
+        EXPECT_EQ(cfg.get().test, 42);
+}
+
+TEST_F(TestReadFileAsync, ReadingErrorIsStoredInFuture)
+{
+    writeConfig("test=forty-two");
+    auto taskQueue = TaskQueue{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfg = cfgReader.readFileAsync<Cfg>(configFile_, std::make_unique<Parser>(), taskQueue.executor());
+    taskQueue.run();
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfg.get();
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'test' value from 'forty-two'");
+            });
+
+    auto missingCfg = cfgReader.readFileAsync<Cfg>(configFile_ / "missing", std::make_unique<Parser>());
+    EXPECT_THROW(missingCfg.get(), figcone::ConfigError);
+}
+
+#ifdef __cpp_impl_coroutine
+TEST_F(TestReadFileAsync, AwaitingCoroutineIsResumedOnResumeExecutor)
+{
+    writeConfig("test=42");
+    auto workerQueue = TaskQueue{};
+    auto callerQueue = TaskQueue{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto result = std::optional<int>{};
+    auto resumeThreadId = std::thread::id{};
+    auto readConfig = [&]() -> Coroutine
+    {
+        auto cfg = co_await cfgReader.readFileAwaitable<Cfg>(
+                configFile_,
+                std::make_unique<Parser>(),
+                workerQueue.executor(),
+                callerQueue.executor());
+        result = cfg.test;
+        resumeThreadId = std::this_thread::get_id();
+    };
+    readConfig();
+    EXPECT_FALSE(result);
+
+    EXPECT_EQ(workerQueue.run(), 1);
+    EXPECT_FALSE(result);
+    EXPECT_EQ(callerQueue.run(), 1);
+    EXPECT_EQ(result, 42);
+    EXPECT_EQ(resumeThreadId, std::this_thread::get_id());
+}
+
+TEST_F(TestReadFileAsync, ReadingErrorIsThrownFromAwaitable)
+{
+    writeConfig("test=forty-two");
+    auto cfgReader = figcone::ConfigReader{};
+    auto errorMessage = std::promise<std::string>{};
+    auto readConfig = [&]() -> Coroutine
+    {
+        try {
+            co_await cfgReader.readFileAwaitable<Cfg>(configFile_, std::make_unique<Parser>());
+            errorMessage.set_value({});
+        }
+        catch (const figcone::ConfigError& error) {
+            errorMessage.set_value(error.what());
+        }
+    };
+    readConfig();
+    EXPECT_EQ(
+            errorMessage.get_future().get(),
+            "[line:1, column:1] Couldn't set parameter 'test' value from 'forty-two'");
+}
+#endif
+
+} //namespace test_readfileasync
\ No newline at end of file
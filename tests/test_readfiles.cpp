@@ -0,0 +1,194 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone/readfileresult.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace test_readfiles {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(test, int);
+};
+
+//parses configs in the "name=value" format containing a single parameter
+class Parser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        auto tree = figcone::makeTreeRoot();
+        const auto delimPos = config.find('=');
+        if (delimPos != std::string::npos)
+            tree->asItem().addParam(config.substr(0, delimPos), config.substr(delimPos + 1), {1, 1});
+        return tree;
+    }
+};
+
+class TestReadFiles : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto testName = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+        configDir_ = std::filesystem::temp_directory_path() / ("figcone_test_readfiles_" + testName);
+        std::filesystem::create_directories(configDir_);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(configDir_);
+    }
+
+    std::filesystem::path writeConfig(const std::string& name, const std::string& config)
+    {
+        const auto configFile = configDir_ / name;
+        auto stream = std::ofstream{configFile, std::ios_base::binary};
+        stream << config;
+        return configFile;
+    }
+
+    std::filesystem::path configDir_;
+};
+
+TEST_F(TestReadFiles, ResultsAreInInputOrder)
+{
+    auto configFiles = std::vector<std::filesystem::path>{};
+    for (auto i = 0; i < 100; ++i)
+        configFiles.emplace_back(writeConfig(std::to_string(i), "test=" + std::to_string(i)));
+
+    for (auto threadCount : {0, 1, 2, 4, 8}) {
+        auto parserCount = std::atomic<int>{};
+        auto cfgReader = figcone::ConfigReader{};
+        auto results = cfgReader.readFiles<Cfg>(
+                configFiles,
+                [&]
+                {
+                    ++parserCount;
+                    return std::make_unique<Parser>();
+                },
+                threadCount);
+
+        ASSERT_EQ(results.size(), configFiles.size());
+        for (auto i = 0; i < 100; ++i) {
+            ASSERT_FALSE(results.at(i).hasError());
+            EXPECT_EQ(results.at(i).value().test, i);
+        }
+        if (threadCount > 0) {
+            EXPECT_LE(parserCount, threadCount);
+        }
+    }
+}
+
+TEST_F(TestReadFiles, ErrorsAreReportedPerFile)
+{
+    auto configFiles = std::vector<std::filesystem::path>{};
+    for (auto i = 0; i < 20; ++i) {
+        if (i == 5)
+            configFiles.emplace_back(configDir_ / "missing");
+        else if (i == 12)
+            configFiles.emplace_back(writeConfig(std::to_string(i), "test=error"));
+        else
+            configFiles.emplace_back(writeConfig(std::to_string(i), "test=" + std::to_string(i)));
+    }
+
+    auto cfgReader = figcone::ConfigReader{};
+    auto results = cfgReader.readFiles<Cfg>(
+            configFiles,
+            []
+            {
+                return std::make_unique<Parser>();
+            },
+            4);
+
+    ASSERT_EQ(results.size(), configFiles.size());
+    for (auto i = 0; i < 20; ++i) {
+        if (i == 5) {
+            ASSERT_TRUE(results.at(i).hasError());
+            EXPECT_EQ(
+                    std::string{results.at(i).error().what()},
+                    "Config file " + figcone::eel::to_string(configFiles.at(i)) + " doesn't exist");
+            EXPECT_THROW(results.at(i).value(), figcone::ConfigError);
+        }
+        else if (i == 12) {
+            ASSERT_TRUE(results.at(i).hasError());
+            EXPECT_EQ(
+                    std::string{results.at(i).error().what()},
+                    "[line:1, column:1] Couldn't set parameter 'test' value from 'error'");
+        }
+        else {
+            ASSERT_FALSE(results.at(i).hasError());
+            EXPECT_EQ(results.at(i).value().test, i);
+        }
+    }
+}
+
+TEST_F(TestReadFiles, EmptyFileList)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    auto results = cfgReader.readFiles<Cfg>(
+            std::vector<std::filesystem::path>{},
+            []
+            {
+                return std::make_unique<Parser>();
+            });
+    EXPECT_TRUE(results.empty());
+}
+
+
+TEST_F(TestReadFiles, ParserErrorsAreStoredInResults)
+{
+    class ThrowingParser : public figcone::IParser {
+    public:
+        figcone::Tree parse(std::istream&) override
+        {
+            throw std::runtime_error{"parser failure"};
+        }
+    };
+
+    const auto configFile = writeConfig("cfg", "test=1");
+    auto cfgReader = figcone::ConfigReader{};
+    auto results = cfgReader.readFiles<Cfg>(
+            {configFile},
+            []
+            {
+                return std::make_unique<ThrowingParser>();
+            });
+
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_TRUE(results.at(0).hasError());
+    EXPECT_EQ(
+            std::string{results.at(0).error().what()},
+            "Couldn't read config file " + figcone::eel::to_string(configFile) + ": parser failure");
+}
+
+TEST_F(TestReadFiles, ParserFactoryErrorsAreStoredInResults)
+{
+    const auto configFile = writeConfig("cfg", "test=1");
+    auto cfgReader = figcone::ConfigReader{};
+    auto results = cfgReader.readFiles<Cfg>(
+            {configFile, configFile},
+            []() -> std::unique_ptr<figcone::IParser>
+            {
+                throw 42;
+            },
+            2);
+
+    ASSERT_EQ(results.size(), 2);
+    for (const auto& result : results) {
+        ASSERT_TRUE(result.hasError());
+        EXPECT_EQ(
+                std::string{result.error().what()},
+                "Couldn't read config file " + figcone::eel::to_string(configFile) + ": unknown error");
+    }
+}
+
+} //namespace test_readfiles
\ No newline at end of file
@@ -0,0 +1,283 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test_readlist {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_PARAM(value, int);
+};
+
+//parses flat configs like '{"name": "foo", "value": 1}' or 'name: foo' lines, quotes and braces are ignored
+class FlatConfigParser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        ++parseCount;
+        auto tree = figcone::makeTreeRoot();
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        for (auto& ch : config)
+            if (ch == ',')
+                ch = '\n';
+
+        auto configStream = std::istringstream{config};
+        auto line = std::string{};
+        auto lineNumber = 0;
+        while (std::getline(configStream, line)) {
+            ++lineNumber;
+            auto field = std::string{};
+            for (auto ch : line)
+                if (ch != '{' && ch != '}' && ch != '"')
+                    field.push_back(ch);
+            const auto delimPos = field.find(':');
+            if (delimPos == std::string::npos)
+                continue;
+            tree->asItem().addParam(trim(field.substr(0, delimPos)), trim(field.substr(delimPos + 1)), {lineNumber, 1});
+        }
+        return tree;
+    }
+
+    int parseCount = 0;
+
+private:
+    static std::string trim(const std::string& str)
+    {
+        const auto begin = str.find_first_not_of(" \t\r");
+        if (begin == std::string::npos)
+            return {};
+        return str.substr(begin, str.find_last_not_of(" \t\r") - begin + 1);
+    }
+};
+
+std::vector<std::pair<std::string, int>> readAll(figcone::ConfigRange<Cfg>& cfgRange)
+{
+    auto result = std::vector<std::pair<std::string, int>>{};
+    for (const auto& cfg : cfgRange)
+        result.emplace_back(cfg.name, cfg.value);
+    return result;
+}
+
+TEST(TestReadList, JsonArray)
+{
+    auto configStream = std::istringstream{R"(
+[
+    {"name": "foo]", "value": 1},
+    {"name": "[bar", "value": 2},
+    {"name": "\"baz\\", "value": 3}
+]
+)"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Json);
+    EXPECT_EQ(
+            readAll(cfgRange),
+            (std::vector<std::pair<std::string, int>>{{"foo]", 1}, {"[bar", 2}, {"\\baz\\\\", 3}}));
+}
+
+TEST(TestReadList, EmptyJsonArray)
+{
+    auto configStream = std::istringstream{" [ ] "};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Json);
+    EXPECT_EQ(cfgRange.begin(), cfgRange.end());
+    EXPECT_EQ(parser.parseCount, 0);
+}
+
+TEST(TestReadList, NewlineDelimitedJson)
+{
+    auto configStream = std::istringstream{R"({"name": "foo", "value": 1}
+
+{"name": "bar", "value": 2}
+{"name": "baz", "value": 3})"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Json);
+    EXPECT_EQ(readAll(cfgRange), (std::vector<std::pair<std::string, int>>{{"foo", 1}, {"bar", 2}, {"baz", 3}}));
+}
+
+TEST(TestReadList, YamlDocuments)
+{
+    auto configStream = std::istringstream{R"(%YAML 1.2
+---
+name: foo
+value: 1
+---
+#comment
+---
+name: bar
+value: 2
+...
+--- name: baz
+value: 3
+)"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Yaml);
+    EXPECT_EQ(readAll(cfgRange), (std::vector<std::pair<std::string, int>>{{"foo", 1}, {"bar", 2}, {"baz", 3}}));
+}
+
+TEST(TestReadList, ConfigsAreReadOneByOne)
+{
+    auto configStream = std::istringstream{"name: foo\nvalue: 1\n---\nname: bar\nvalue: 2\n---\nname: baz\nvalue: 3"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Yaml);
+    EXPECT_EQ(parser.parseCount, 0);
+
+    auto it = cfgRange.begin();
+    EXPECT_EQ(parser.parseCount, 1);
+    EXPECT_EQ(it->name, "foo");
+    ++it;
+    EXPECT_EQ(parser.parseCount, 2);
+    EXPECT_EQ(it->name, "bar");
+    ++it;
+    EXPECT_EQ(parser.parseCount, 3);
+    EXPECT_EQ(it->name, "baz");
+    ++it;
+    EXPECT_EQ(it, cfgRange.end());
+}
+
+TEST(TestReadList, InvalidElementError)
+{
+    auto configStream = std::istringstream{R"([
+    {"name": "foo", "value": 1},
+    {"name": "bar"}
+])"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Json);
+    auto it = cfgRange.begin();
+    EXPECT_EQ(it->name, "foo");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                ++it;
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:3, column:5] Config list element: Root node: Parameter 'value' is missing.");
+            });
+    EXPECT_EQ(it, cfgRange.end());
+}
+
+TEST(TestReadList, InvalidElementFieldErrorHasListPosition)
+{
+    auto configStream = std::istringstream{"name: foo\n"
+                                           "value: 1\n"
+                                           "---\n"
+                                           "name: bar\n"
+                                           "value: many\n"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Yaml);
+    auto it = cfgRange.begin();
+    EXPECT_EQ(it->name, "foo");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                ++it;
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:5, column:1] Config list element: Couldn't set parameter 'value' value from 'many'");
+            });
+}
+
+TEST(TestReadList, UnclosedJsonArrayError)
+{
+    auto configStream = std::istringstream{"[\n{\"name\": \"foo\", \"value\": 1},\n{\"name\": \"bar\""};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Json);
+    auto it = cfgRange.begin();
+    EXPECT_EQ(it->name, "foo");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                ++it;
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:3, column:15] JSON list must be closed with ']'");
+            });
+}
+
+
+TEST(TestReadList, TrailingContentAfterJsonArrayError)
+{
+    auto configStream = std::istringstream{"[\n{\"name\": \"foo\", \"value\": 1}\n] \n{\"name\": \"bar\"}"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Json);
+    auto it = cfgRange.begin();
+    EXPECT_EQ(it->name, "foo");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                ++it;
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:4, column:1] Unexpected content after the end of JSON list");
+            });
+}
+
+TEST(TestReadList, TrailingContentAfterEmptyJsonArrayError)
+{
+    auto configStream = std::istringstream{"[] x"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = cfgReader.readList<Cfg>(configStream, parser, figcone::ConfigListFormat::Json);
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgRange.begin();
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:4] Unexpected content after the end of JSON list");
+            });
+}
+
+figcone::ConfigRange<Cfg> makeRange(figcone::ConfigReader& cfgReader, std::istream& stream, figcone::IParser& parser)
+{
+    auto cfgRange = cfgReader.readList<Cfg>(stream, parser, figcone::ConfigListFormat::Json);
+    return cfgRange;
+}
+
+TEST(TestReadList, MovedRange)
+{
+    auto configStream = std::istringstream{R"([{"name": "foo", "value": 1}, {"name": "bar", "value": 2}])"};
+    auto parser = FlatConfigParser{};
+    auto cfgReader = figcone::ConfigReader{};
+    auto cfgRange = makeRange(cfgReader, configStream, parser);
+    EXPECT_EQ(cfgRange.begin()->name, "foo");
+
+    auto movedCfgRange = std::move(cfgRange);
+    auto it = movedCfgRange.begin();
+    EXPECT_EQ(it->name, "foo");
+    ++it;
+    EXPECT_EQ(it->name, "bar");
+    ++it;
+    EXPECT_EQ(it, movedCfgRange.end());
+}
+
+} //namespace test_readlist
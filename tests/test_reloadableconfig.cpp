@@ -0,0 +1,380 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/errors.h>
+#include <figcone/reloadableconfig.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test_reloadableconfig {
+
+int hostValidationCount = 0;
+int nameValidationCount = 0;
+
+struct Database : public figcone::Config {
+    FIGCONE_PARAM(host, std::string)
+            .ensure(
+                    [](const std::string&)
+                    {
+                        ++hostValidationCount;
+                    });
+    FIGCONE_PARAM(port, int)(5432);
+};
+
+struct User : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+};
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string)
+            .ensure(
+                    [](const std::string& name)
+                    {
+                        ++nameValidationCount;
+                        if (name.empty())
+                            throw figcone::ValidationError{"can't be empty"};
+                    });
+    FIGCONE_PARAMLIST(ports, std::vector<int>)();
+    FIGCONE_NODE(database, Database);
+    FIGCONE_NODELIST(users, std::vector<User>)();
+};
+
+struct PostProcessedCfg : public figcone::Config {
+    FIGCONE_PARAM(name, std::string);
+    FIGCONE_NODE(database, Database);
+};
+
+} //namespace test_reloadableconfig
+
+template<>
+void figcone::PostProcessor<test_reloadableconfig::PostProcessedCfg>::operator()(
+        test_reloadableconfig::PostProcessedCfg& cfg)
+{
+    cfg.name += "!";
+}
+
+namespace test_reloadableconfig {
+
+//parses configs with a "node.param=value" field on each line, "[a, b]" values are parsed as lists,
+//"@list.param=value" lines add elements to node lists
+class Parser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        auto tree = figcone::makeTreeRoot();
+        auto line = std::string{};
+        auto lineNumber = 0;
+        while (std::getline(stream, line)) {
+            ++lineNumber;
+            const auto delimPos = line.find('=');
+            if (delimPos == std::string::npos)
+                continue;
+            const auto position = figcone::StreamPosition{lineNumber, 1};
+            auto path = line.substr(0, delimPos);
+            const auto value = line.substr(delimPos + 1);
+
+            auto node = tree.get();
+            if (path.front() == '@') {
+                const auto listName = path.substr(1, path.find('.') - 1);
+                auto& item = node->asItem();
+                auto& list = item.hasNode(listName) ? const_cast<figcone::TreeNode&>(item.node(listName))
+                                                    : item.addNodeList(listName, position);
+                node = &list.asList().emplaceBack(position);
+                path = path.substr(path.find('.') + 1);
+            }
+            for (auto dotPos = path.find('.'); dotPos != std::string::npos; dotPos = path.find('.')) {
+                const auto nodeName = path.substr(0, dotPos);
+                auto& item = node->asItem();
+                node = item.hasNode(nodeName) ? &const_cast<figcone::TreeNode&>(item.node(nodeName))
+                                              : &item.addNode(nodeName, position);
+                path = path.substr(dotPos + 1);
+            }
+            if (!value.empty() && value.front() == '[')
+                node->asItem().addParamList(path, splitList(value.substr(1, value.size() - 2)), position);
+            else
+                node->asItem().addParam(path, value, position);
+        }
+        return tree;
+    }
+
+private:
+    static std::vector<std::string> splitList(const std::string& value)
+    {
+        auto result = std::vector<std::string>{};
+        auto stream = std::stringstream{value};
+        auto element = std::string{};
+        while (std::getline(stream, element, ','))
+            result.push_back(element);
+        return result;
+    }
+};
+
+class TestReloadableConfig : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto testName = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+        configFile_ = std::filesystem::temp_directory_path() / ("figcone_test_reloadableconfig_" + testName);
+        hostValidationCount = 0;
+        nameValidationCount = 0;
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(configFile_);
+    }
+
+    void writeConfig(const std::string& config)
+    {
+        auto stream = std::ofstream{configFile_, std::ios_base::binary};
+        stream << config;
+    }
+
+    std::filesystem::path configFile_;
+};
+
+TEST_F(TestReloadableConfig, ChangedFieldsAreReloaded)
+{
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "database.port=5432\n");
+    auto cfg = figcone::ReloadableConfig<Cfg>{configFile_, std::make_unique<Parser>()};
+    const auto firstCfg = cfg.get();
+    EXPECT_EQ(hostValidationCount, 1);
+    EXPECT_EQ(nameValidationCount, 1);
+
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "database.port=6432\n"
+                "ports=[80,443]\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"ports", "database.port"}));
+    EXPECT_EQ(cfg.get()->name, "app");
+    EXPECT_EQ(cfg.get()->database.host, "localhost");
+    EXPECT_EQ(cfg.get()->database.port, 6432);
+    EXPECT_EQ(cfg.get()->ports, (std::vector<int>{80, 443}));
+    EXPECT_EQ(firstCfg->database.port, 5432);
+    EXPECT_TRUE(firstCfg->ports.empty());
+    //the validators are called for the changed nodes only
+    EXPECT_EQ(hostValidationCount, 2);
+    EXPECT_EQ(nameValidationCount, 2);
+
+    writeConfig("name=service\n"
+                "database.host=localhost\n"
+                "database.port=6432\n"
+                "ports=[80,443]\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"name"}));
+    EXPECT_EQ(cfg.get()->name, "service");
+    EXPECT_EQ(cfg.get()->database.port, 6432);
+    EXPECT_EQ(hostValidationCount, 2);
+    EXPECT_EQ(nameValidationCount, 3);
+}
+
+TEST_F(TestReloadableConfig, UnchangedConfigIsNotReplaced)
+{
+    writeConfig("name=app\n"
+                "database.host=localhost\n");
+    auto cfg = figcone::ReloadableConfig<Cfg>{configFile_, std::make_unique<Parser>()};
+    const auto firstCfg = cfg.get();
+
+    writeConfig("\n"
+                "name=app\n"
+                "database.host=localhost\n");
+    EXPECT_TRUE(cfg.reload().empty());
+    EXPECT_EQ(cfg.get(), firstCfg);
+}
+
+TEST_F(TestReloadableConfig, RemovedFieldsReloadWholeConfig)
+{
+    writeConfig("name=app\n"
+                "ports=[80]\n"
+                "database.host=localhost\n"
+                "database.port=6432\n");
+    auto cfg = figcone::ReloadableConfig<Cfg>{configFile_, std::make_unique<Parser>()};
+
+    writeConfig("name=app\n"
+                "database.host=localhost\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"ports", "database.port"}));
+    EXPECT_TRUE(cfg.get()->ports.empty());
+    EXPECT_EQ(cfg.get()->database.port, 5432);
+}
+
+TEST_F(TestReloadableConfig, NodeListIsReportedAsWhole)
+{
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "@users.name=admin\n");
+    auto cfg = figcone::ReloadableConfig<Cfg>{configFile_, std::make_unique<Parser>()};
+
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "@users.name=admin\n"
+                "@users.name=guest\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"users"}));
+    ASSERT_EQ(cfg.get()->users.size(), 2);
+    EXPECT_EQ(cfg.get()->users.at(0).name, "admin");
+    EXPECT_EQ(cfg.get()->users.at(1).name, "guest");
+}
+
+TEST_F(TestReloadableConfig, InvalidChangeKeepsCurrentConfig)
+{
+    writeConfig("name=app\n"
+                "database.host=localhost\n");
+    auto cfg = figcone::ReloadableConfig<Cfg>{configFile_, std::make_unique<Parser>()};
+
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "database.port=many\n");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfg.reload();
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:3, column:1] Couldn't set parameter 'port' value from 'many'");
+            });
+    EXPECT_EQ(cfg.get()->database.port, 5432);
+
+    writeConfig("name=\n"
+                "database.host=localhost\n");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfg.reload();
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:1, column:1] Parameter 'name': can't be empty");
+            });
+    EXPECT_EQ(cfg.get()->name, "app");
+
+    writeConfig("name=service\n"
+                "database.host=localhost\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"name"}));
+    EXPECT_EQ(cfg.get()->name, "service");
+}
+
+TEST_F(TestReloadableConfig, UnchangedFieldsAreNotPostProcessedAgain)
+{
+    writeConfig("name=app\n"
+                "database.host=localhost\n");
+    auto cfg = figcone::ReloadableConfig<PostProcessedCfg>{configFile_, std::make_unique<Parser>()};
+    EXPECT_EQ(cfg.get()->name, "app!");
+
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "database.port=6432\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"database.port"}));
+    EXPECT_EQ(cfg.get()->name, "app!");
+    EXPECT_EQ(cfg.get()->database.port, 6432);
+
+    writeConfig("name=app\n"
+                "database.host=db.local\n"
+                "database.port=6432\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"database.host"}));
+    EXPECT_EQ(cfg.get()->name, "app!");
+    EXPECT_EQ(cfg.get()->database.host, "db.local");
+
+    writeConfig("name=service\n"
+                "database.host=db.local\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"name", "database.port"}));
+    EXPECT_EQ(cfg.get()->name, "service!");
+    EXPECT_EQ(cfg.get()->database.port, 5432);
+
+    writeConfig("name=service\n"
+                "database.host=localhost\n");
+    EXPECT_EQ(cfg.reload(), (std::vector<std::string>{"database.host"}));
+    EXPECT_EQ(cfg.get()->name, "service!");
+}
+
+TEST_F(TestReloadableConfig, SubscribersOfChangedFieldsAreNotified)
+{
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "@users.name=admin\n");
+    auto cfg = figcone::ReloadableConfig<Cfg>{configFile_, std::make_unique<Parser>()};
+    auto databasePorts = std::vector<int>{};
+    auto hosts = std::vector<std::string>{};
+    auto names = std::vector<std::string>{};
+    auto userCounts = std::vector<std::size_t>{};
+    cfg.subscribe(
+            &Cfg::database,
+            [&](const Database& database)
+            {
+                databasePorts.push_back(database.port);
+            });
+    cfg.subscribe(
+            "database.host",
+            [&](const Cfg& newCfg)
+            {
+                hosts.push_back(newCfg.database.host);
+            });
+    cfg.subscribe(
+            &Cfg::name,
+            [&](const std::string& name)
+            {
+                names.push_back(name);
+            });
+    cfg.subscribe(
+            "users.name",
+            [&](const Cfg& newCfg)
+            {
+                userCounts.push_back(newCfg.users.size());
+            });
+
+    writeConfig("name=app\n"
+                "database.host=localhost\n"
+                "database.port=6432\n"
+                "@users.name=admin\n");
+    cfg.reload();
+    EXPECT_EQ(databasePorts, (std::vector<int>{6432}));
+    EXPECT_TRUE(hosts.empty());
+    EXPECT_TRUE(names.empty());
+    EXPECT_TRUE(userCounts.empty());
+
+    writeConfig("name=service\n"
+                "database.host=127.0.0.1\n"
+                "database.port=7432\n"
+                "@users.name=admin\n"
+                "@users.name=guest\n");
+    cfg.reload();
+    EXPECT_EQ(databasePorts, (std::vector<int>{6432, 7432}));
+    EXPECT_EQ(hosts, (std::vector<std::string>{"127.0.0.1"}));
+    EXPECT_EQ(names, (std::vector<std::string>{"service"}));
+    EXPECT_EQ(userCounts, (std::vector<std::size_t>{2}));
+
+    cfg.reload();
+    EXPECT_EQ(databasePorts.size(), 2);
+    EXPECT_EQ(hosts.size(), 1);
+    EXPECT_EQ(names.size(), 1);
+    EXPECT_EQ(userCounts.size(), 1);
+}
+
+TEST_F(TestReloadableConfig, SubscribersAreNotNotifiedOnInvalidChange)
+{
+    writeConfig("name=app\n"
+                "database.host=localhost\n");
+    auto cfg = figcone::ReloadableConfig<Cfg>{configFile_, std::make_unique<Parser>()};
+    auto notificationCount = 0;
+    cfg.subscribe(
+            &Cfg::name,
+            [&](const std::string&)
+            {
+                ++notificationCount;
+            });
+
+    writeConfig("name=\n"
+                "database.host=localhost\n");
+    EXPECT_THROW(cfg.reload(), figcone::ConfigError);
+    EXPECT_EQ(notificationCount, 0);
+}
+
+} //namespace test_reloadableconfig
\ No newline at end of file
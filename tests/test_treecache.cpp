@@ -0,0 +1,192 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/treecache.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_treecache {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(test, std::string);
+};
+
+struct IntCfg : public figcone::Config {
+    FIGCONE_PARAM(test, int);
+};
+
+//parses configs in the "name=value" format containing a single parameter
+class Parser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        ++parseCount;
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        auto tree = figcone::makeTreeRoot();
+        const auto delimPos = config.find('=');
+        if (delimPos != std::string::npos)
+            tree->asItem().addParam(config.substr(0, delimPos), config.substr(delimPos + 1), {1, 1});
+        return tree;
+    }
+
+    std::atomic<int> parseCount{};
+};
+
+class AnotherParser : public Parser {};
+
+class TestTreeCache : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto testName = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+        configFile_ = std::filesystem::temp_directory_path() / ("figcone_test_treecache_" + testName);
+        secondConfigFile_ = std::filesystem::temp_directory_path() / ("figcone_test_treecache_2_" + testName);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(configFile_);
+        std::filesystem::remove(secondConfigFile_);
+    }
+
+    static void writeConfig(const std::filesystem::path& configFile, const std::string& config)
+    {
+        auto stream = std::ofstream{configFile, std::ios_base::binary};
+        stream << config;
+    }
+
+    std::filesystem::path configFile_;
+    std::filesystem::path secondConfigFile_;
+};
+
+TEST_F(TestTreeCache, RepeatedReadsOfUnchangedFile)
+{
+    writeConfig(configFile_, "test=42");
+    auto treeCache = std::make_shared<figcone::TreeCache>();
+    auto parser = Parser{};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, treeCache};
+    auto anotherCfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, treeCache};
+
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+    auto intCfg = anotherCfgReader.readFile<IntCfg>(configFile_, parser);
+    auto cfg2 = anotherCfgReader.readFile<Cfg>(configFile_, parser);
+
+    EXPECT_EQ(cfg.test, "42");
+    EXPECT_EQ(intCfg.test, 42);
+    EXPECT_EQ(cfg2.test, "42");
+    EXPECT_EQ(parser.parseCount, 1);
+    EXPECT_EQ(treeCache->size(), 1);
+}
+
+TEST_F(TestTreeCache, ChangedFileIsParsedAgain)
+{
+    writeConfig(configFile_, "test=42");
+    auto parser = Parser{};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, std::make_shared<figcone::TreeCache>()};
+    auto cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+    EXPECT_EQ(cfg.test, "42");
+
+    writeConfig(configFile_, "test=1024");
+    cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+    EXPECT_EQ(cfg.test, "1024");
+    EXPECT_EQ(parser.parseCount, 2);
+
+    cfg = cfgReader.readFile<Cfg>(configFile_, parser);
+    EXPECT_EQ(cfg.test, "1024");
+    EXPECT_EQ(parser.parseCount, 2);
+}
+
+TEST_F(TestTreeCache, TreesAreCachedPerParserType)
+{
+    writeConfig(configFile_, "test=42");
+    auto treeCache = std::make_shared<figcone::TreeCache>();
+    auto parser = Parser{};
+    auto anotherParser = AnotherParser{};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, treeCache};
+
+    cfgReader.readFile<Cfg>(configFile_, parser);
+    cfgReader.readFile<Cfg>(configFile_, anotherParser);
+    cfgReader.readFile<Cfg>(configFile_, anotherParser);
+
+    EXPECT_EQ(parser.parseCount, 1);
+    EXPECT_EQ(anotherParser.parseCount, 1);
+    EXPECT_EQ(treeCache->size(), 2);
+}
+
+TEST_F(TestTreeCache, LeastRecentlyUsedTreeIsEvicted)
+{
+    writeConfig(configFile_, "test=42");
+    writeConfig(secondConfigFile_, "test=43");
+
+    auto parser = Parser{};
+    auto treeCache = std::make_shared<figcone::TreeCache>();
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, treeCache};
+    cfgReader.readFile<Cfg>(configFile_, parser);
+    const auto treeMemoryUsage = treeCache->memoryUsage();
+    ASSERT_GT(treeMemoryUsage, 0);
+
+    auto smallTreeCache = std::make_shared<figcone::TreeCache>(treeMemoryUsage);
+    auto smallCacheCfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, smallTreeCache};
+    parser.parseCount = 0;
+    EXPECT_EQ(smallCacheCfgReader.readFile<Cfg>(configFile_, parser).test, "42");
+    EXPECT_EQ(smallCacheCfgReader.readFile<Cfg>(secondConfigFile_, parser).test, "43");
+    EXPECT_EQ(smallCacheCfgReader.readFile<Cfg>(secondConfigFile_, parser).test, "43");
+    EXPECT_EQ(parser.parseCount, 2);
+    EXPECT_EQ(smallCacheCfgReader.readFile<Cfg>(configFile_, parser).test, "42");
+    EXPECT_EQ(parser.parseCount, 3);
+    EXPECT_EQ(smallTreeCache->size(), 1);
+    EXPECT_LE(smallTreeCache->memoryUsage(), treeMemoryUsage);
+}
+
+TEST_F(TestTreeCache, TreeLargerThanMemoryLimitIsNotCached)
+{
+    writeConfig(configFile_, "test=42");
+    auto parser = Parser{};
+    auto treeCache = std::make_shared<figcone::TreeCache>(1);
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, treeCache};
+
+    EXPECT_EQ(cfgReader.readFile<Cfg>(configFile_, parser).test, "42");
+    EXPECT_EQ(cfgReader.readFile<Cfg>(configFile_, parser).test, "42");
+    EXPECT_EQ(parser.parseCount, 2);
+    EXPECT_EQ(treeCache->size(), 0);
+    EXPECT_EQ(treeCache->memoryUsage(), 0);
+}
+
+TEST_F(TestTreeCache, ConcurrentReads)
+{
+    writeConfig(configFile_, "test=42");
+    writeConfig(secondConfigFile_, "test=43");
+    auto parser = Parser{};
+    auto treeCache = std::make_shared<figcone::TreeCache>();
+
+    auto threads = std::vector<std::thread>{};
+    auto errorCount = std::atomic<int>{};
+    for (auto threadIndex = 0; threadIndex < 8; ++threadIndex)
+        threads.emplace_back(
+                [&, threadIndex]
+                {
+                    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, {}, treeCache};
+                    for (auto i = 0; i < 100; ++i) {
+                        const auto isSecondFile = (threadIndex + i) % 2;
+                        auto cfg = cfgReader.readFile<IntCfg>(isSecondFile ? secondConfigFile_ : configFile_, parser);
+                        if (cfg.test != (isSecondFile ? 43 : 42))
+                            ++errorCount;
+                    }
+                });
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(errorCount, 0);
+    EXPECT_EQ(treeCache->size(), 2);
+    EXPECT_LT(parser.parseCount, 800);
+}
+
+} //namespace test_treecache
\ No newline at end of file
@@ -0,0 +1,271 @@
+#include "assert_exception.h"
+#include <figcone/config.h>
+#include <figcone/errors.h>
+#include <figcone/watched.h>
+#include <figcone_tree/iparser.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace test_watched {
+
+struct Cfg : public figcone::Config {
+    FIGCONE_PARAM(test, int);
+};
+
+//parses configs in the "name=value" format containing a single parameter
+class Parser : public figcone::IParser {
+public:
+    figcone::Tree parse(std::istream& stream) override
+    {
+        auto config = std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        if (config == "throw")
+            throw std::runtime_error{"parser failure"};
+        auto tree = figcone::makeTreeRoot();
+        const auto delimPos = config.find('=');
+        if (delimPos != std::string::npos)
+            tree->asItem().addParam(config.substr(0, delimPos), config.substr(delimPos + 1), {1, 1});
+        return tree;
+    }
+};
+
+class TestWatched : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        const auto testName = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+        configDir_ = std::filesystem::temp_directory_path() / ("figcone_test_watched_" + testName);
+        std::filesystem::create_directories(configDir_);
+        configFile_ = configDir_ / "cfg";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(configDir_);
+    }
+
+    void writeConfig(const std::string& config, const std::filesystem::path& configFile)
+    {
+        auto stream = std::ofstream{configFile, std::ios_base::binary};
+        stream << config;
+    }
+
+    void writeConfig(const std::string& config)
+    {
+        writeConfig(config, configFile_);
+    }
+
+    //waits up to 10 seconds for the condition to become true
+    static bool waitFor(const std::function<bool()>& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        return true;
+    }
+
+    std::filesystem::path configDir_;
+    std::filesystem::path configFile_;
+};
+
+TEST_F(TestWatched, InitialRead)
+{
+    writeConfig("test=1");
+    auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>()};
+    EXPECT_EQ(cfg.get()->test, 1);
+}
+
+TEST_F(TestWatched, InitialReadError)
+{
+    writeConfig("test=hello");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>()};
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'test' value from 'hello'");
+            });
+}
+
+TEST_F(TestWatched, ReloadKeepsPreviousSnapshots)
+{
+    writeConfig("test=1");
+    auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>()};
+    const auto firstCfg = cfg.get();
+
+    writeConfig("test=2");
+    cfg.reload();
+    EXPECT_EQ(cfg.get()->test, 2);
+    EXPECT_EQ(firstCfg->test, 1);
+}
+
+TEST_F(TestWatched, FailedReloadKeepsCurrentConfig)
+{
+    writeConfig("test=1");
+    auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>()};
+
+    writeConfig("test=hello");
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfg.reload();
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(
+                        std::string{error.what()},
+                        "[line:1, column:1] Couldn't set parameter 'test' value from 'hello'");
+            });
+    EXPECT_EQ(cfg.get()->test, 1);
+}
+
+TEST_F(TestWatched, FileChangeIsReloaded)
+{
+    writeConfig("test=1");
+    auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>(), {}, std::chrono::milliseconds{10}};
+
+    writeConfig("test=2");
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return cfg.get()->test == 2;
+            }));
+}
+
+TEST_F(TestWatched, ReplacedFileIsReloaded)
+{
+    writeConfig("test=1");
+    auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>(), {}, std::chrono::milliseconds{10}};
+
+    const auto newConfigFile = configDir_ / "cfg.new";
+    writeConfig("test=2", newConfigFile);
+    std::filesystem::rename(newConfigFile, configFile_);
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return cfg.get()->test == 2;
+            }));
+}
+
+TEST_F(TestWatched, ReloadErrorIsReported)
+{
+    writeConfig("test=1");
+    auto errorCount = std::atomic<int>{};
+    auto cfg = figcone::Watched<Cfg>{
+            configFile_,
+            std::make_unique<Parser>(),
+            [&](const figcone::ConfigError&)
+            {
+                ++errorCount;
+            },
+            std::chrono::milliseconds{10}};
+
+    writeConfig("test=hello");
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return errorCount > 0;
+            }));
+    EXPECT_EQ(cfg.get()->test, 1);
+
+    writeConfig("test=3");
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return cfg.get()->test == 3;
+            }));
+}
+
+TEST_F(TestWatched, NonConfigErrorIsReported)
+{
+    writeConfig("test=1");
+    auto errorMessage = std::string{};
+    auto errorCount = std::atomic<int>{};
+    auto cfg = figcone::Watched<Cfg>{
+            configFile_,
+            std::make_unique<Parser>(),
+            [&](const figcone::ConfigError& error)
+            {
+                errorMessage = error.what();
+                ++errorCount;
+            },
+            std::chrono::milliseconds{10}};
+
+    writeConfig("throw");
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return errorCount > 0;
+            }));
+    EXPECT_EQ(errorMessage, "Couldn't reload config: parser failure");
+    EXPECT_EQ(cfg.get()->test, 1);
+
+    writeConfig("test=3");
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return cfg.get()->test == 3;
+            }));
+}
+
+#ifndef _WIN32
+TEST_F(TestWatched, SymlinkTargetChangeIsReloaded)
+{
+    const auto targetDir = configDir_ / "target";
+    std::filesystem::create_directories(targetDir);
+    writeConfig("test=1", targetDir / "cfg");
+    std::filesystem::create_symlink(targetDir / "cfg", configFile_);
+    auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>(), {}, std::chrono::milliseconds{10}};
+
+    writeConfig("test=2", targetDir / "cfg");
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return cfg.get()->test == 2;
+            }));
+}
+
+TEST_F(TestWatched, SwappedSymlinkDirectoryIsReloaded)
+{
+    ///
+    /// The layout of a mounted Kubernetes config map:
+    /// cfg -> ..data/cfg
+    /// ..data -> ..v1
+    /// ..v1/cfg
+    ///
+    std::filesystem::create_directories(configDir_ / "..v1");
+    writeConfig("test=1", configDir_ / "..v1" / "cfg");
+    std::filesystem::create_directory_symlink("..v1", configDir_ / "..data");
+    std::filesystem::create_symlink(std::filesystem::path{"..data"} / "cfg", configFile_);
+    auto cfg = figcone::Watched<Cfg>{configFile_, std::make_unique<Parser>(), {}, std::chrono::milliseconds{10}};
+
+    std::filesystem::create_directories(configDir_ / "..v2");
+    writeConfig("test=2", configDir_ / "..v2" / "cfg");
+    std::filesystem::create_directory_symlink("..v2", configDir_ / "..data_tmp");
+    std::filesystem::rename(configDir_ / "..data_tmp", configDir_ / "..data");
+    std::filesystem::remove_all(configDir_ / "..v1");
+    EXPECT_TRUE(waitFor(
+            [&]
+            {
+                return cfg.get()->test == 2;
+            }));
+}
+#endif
+
+} //namespace test_watched
\ No newline at end of file
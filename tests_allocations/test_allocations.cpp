@@ -0,0 +1,144 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<bool> isAllocationCountEnabled = false;
+std::atomic<int> allocationCount = 0;
+} //namespace
+
+void* operator new(std::size_t size)
+{
+    if (isAllocationCountEnabled)
+        ++allocationCount;
+    if (auto ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace test_allocations {
+
+//binder objects are created once per config type by the reader's cached schema, so repeated reads
+//should only allocate a small fixed number of times
+constexpr auto maxAllocationCountPerRead = 4;
+
+struct ServiceEndpointCfg : public figcone::Config {
+    FIGCONE_PARAM(serviceEndpointHost, std::string);
+    FIGCONE_PARAM(serviceEndpointPort, int);
+};
+
+struct SmallCfg : public figcone::Config {
+    FIGCONE_PARAM(connectionTimeoutMs, int);
+    FIGCONE_PARAM(isCompressionEnabled, bool);
+    FIGCONE_NODE(primaryServiceEndpoint, ServiceEndpointCfg);
+};
+
+struct LargeCfg : public figcone::Config {
+    FIGCONE_PARAM(connectionTimeoutMs, int);
+    FIGCONE_PARAM(isCompressionEnabled, bool);
+    FIGCONE_PARAM(maximumRetryAttemptCount, int).ensure(
+            [](int value)
+            {
+                if (value < 0)
+                    throw figcone::ValidationError{"value can't be negative"};
+            });
+    FIGCONE_PARAM(retryBackoffIntervalMs, int);
+    FIGCONE_PARAM(isTelemetryCollectionEnabled, bool)(false);
+    FIGCONE_PARAM(optionalDescriptionText, figcone::optional<std::string>);
+    FIGCONE_NODE(primaryServiceEndpoint, ServiceEndpointCfg);
+    FIGCONE_NODE(secondaryServiceEndpoint, ServiceEndpointCfg);
+    FIGCONE_NODE(fallbackServiceEndpoint, figcone::optional<ServiceEndpointCfg>);
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+void addEndpoint(figcone::TreeNode& tree, const std::string& name)
+{
+    auto& endpoint = tree.asItem().addNode(name, {1, 1});
+    endpoint.asItem().addParam("serviceEndpointHost", "localhost", {1, 1});
+    endpoint.asItem().addParam("serviceEndpointPort", "8080", {1, 1});
+}
+
+std::unique_ptr<figcone::TreeNode> makeSmallTree()
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("connectionTimeoutMs", "100", {1, 1});
+    tree->asItem().addParam("isCompressionEnabled", "1", {1, 1});
+    addEndpoint(*tree, "primaryServiceEndpoint");
+    return tree;
+}
+
+std::unique_ptr<figcone::TreeNode> makeLargeTree()
+{
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("connectionTimeoutMs", "100", {1, 1});
+    tree->asItem().addParam("isCompressionEnabled", "1", {1, 1});
+    tree->asItem().addParam("maximumRetryAttemptCount", "3", {1, 1});
+    tree->asItem().addParam("retryBackoffIntervalMs", "250", {1, 1});
+    tree->asItem().addParam("isTelemetryCollectionEnabled", "0", {1, 1});
+    tree->asItem().addParam("optionalDescriptionText", "test", {1, 1});
+    addEndpoint(*tree, "primaryServiceEndpoint");
+    addEndpoint(*tree, "secondaryServiceEndpoint");
+    addEndpoint(*tree, "fallbackServiceEndpoint");
+    return tree;
+}
+
+template<typename TCfg>
+int countAllocationsPerRead(figcone::ConfigReader& cfgReader, std::unique_ptr<figcone::TreeNode> tree)
+{
+    auto parser = TreeProvider{std::move(tree)};
+    allocationCount = 0;
+    isAllocationCountEnabled = true;
+    cfgReader.read<TCfg>("", parser);
+    isAllocationCountEnabled = false;
+    return allocationCount;
+}
+
+TEST(TestAllocations, AllocationCountPerReadDoesntDependOnFieldCount)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    countAllocationsPerRead<SmallCfg>(cfgReader, makeSmallTree());
+    countAllocationsPerRead<LargeCfg>(cfgReader, makeLargeTree());
+
+    auto smallCfgAllocationCount = countAllocationsPerRead<SmallCfg>(cfgReader, makeSmallTree());
+    auto largeCfgAllocationCount = countAllocationsPerRead<LargeCfg>(cfgReader, makeLargeTree());
+    EXPECT_EQ(smallCfgAllocationCount, largeCfgAllocationCount);
+}
+
+TEST(TestAllocations, AllocationCountPerReadIsBounded)
+{
+    auto cfgReader = figcone::ConfigReader{};
+    countAllocationsPerRead<LargeCfg>(cfgReader, makeLargeTree());
+
+    for (auto i = 0; i < 3; ++i)
+        EXPECT_LE(countAllocationsPerRead<LargeCfg>(cfgReader, makeLargeTree()), maxAllocationCountPerRead);
+}
+
+} //namespace test_allocations
\ No newline at end of file
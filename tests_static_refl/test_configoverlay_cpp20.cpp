@@ -0,0 +1,92 @@
+#include "assert_exception.h"
+#include <figcone/configoverlay.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace test_configoverlay {
+
+struct Database {
+    std::string host;
+    int poolSize;
+};
+
+struct Cfg {
+    std::string name;
+    std::vector<int> ports;
+    Database database;
+};
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+TEST(StaticReflTestConfigOverlay, OverlayOverridesFields)
+{
+    ///
+    /// name = app
+    /// ports = [80]
+    /// [database]
+    ///   host = localhost
+    ///   pool_size = 8
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "app", {1, 1});
+    tree->asItem().addParamList("ports", std::vector<std::string>{"80"}, {2, 1});
+    auto& database = tree->asItem().addNode("database", {3, 1});
+    database.asItem().addParam("host", "localhost", {4, 3});
+    database.asItem().addParam("pool_size", "8", {5, 3});
+
+    const char* argv[] = {"app", "--database.poolSize=64", "--ports=[80, 8080]"};
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.addCommandLine(3, argv);
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::SnakeCase};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.name, "app");
+    EXPECT_EQ(cfg.ports, (std::vector<int>{80, 8080}));
+    EXPECT_EQ(cfg.database.host, "localhost");
+    EXPECT_EQ(cfg.database.poolSize, 64);
+}
+
+TEST(StaticReflTestConfigOverlay, MissingNodeIsProvidedByOverlay)
+{
+    ///
+    /// name = app
+    /// ports = [80]
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("name", "app", {1, 1});
+    tree->asItem().addParamList("ports", std::vector<std::string>{"80"}, {2, 1});
+
+    auto overlay = figcone::ConfigOverlay{};
+    overlay.set("database.host", "db.local");
+    overlay.set("database.pool_size", "4");
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{};
+    cfgReader.setOverlay(overlay);
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    EXPECT_EQ(cfg.database.host, "db.local");
+    EXPECT_EQ(cfg.database.poolSize, 4);
+}
+
+} //namespace test_configoverlay
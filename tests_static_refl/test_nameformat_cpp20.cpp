@@ -0,0 +1,102 @@
+#include <figcone/config.h>
+#include <figcone/configreader.h>
+#include <figcone/errors.h>
+#include <figcone_tree/tree.h>
+#include <gtest/gtest.h>
+
+namespace test_nameformat {
+
+class TreeProvider : public figcone::IParser {
+public:
+    TreeProvider(std::unique_ptr<figcone::TreeNode> tree)
+        : tree_{std::move(tree)}
+    {
+    }
+
+    figcone::Tree parse(std::istream&) override
+    {
+        return std::move(tree_);
+    }
+
+    std::unique_ptr<figcone::TreeNode> tree_;
+};
+
+struct InnerSnakeStructCamelCfg {
+    std::string test_str;
+};
+
+struct SnakeStructCamelCfg {
+    int test_int;
+    InnerSnakeStructCamelCfg test_inner;
+};
+
+TEST(StaticReflNameFormat, SnakeStructCamelCfg)
+{
+    ///testInt = 10
+    ///#testInner:
+    ///  testStr = Hello
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testInt", "10", {1, 1});
+    auto& node = tree->asItem().addNode("testInner", {2, 1});
+    node.asItem().addParam("testStr", "Hello", {3, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    auto cfg = cfgReader.read<SnakeStructCamelCfg>("", parser);
+    EXPECT_EQ(cfg.test_int, 10);
+    EXPECT_EQ(cfg.test_inner.test_str, "Hello");
+}
+
+struct InnerCamelStructSnakeCfg {
+    std::string testStr;
+};
+
+struct CamelStructSnakeCfg {
+    int testInt;
+    std::vector<InnerCamelStructSnakeCfg> testInnerList;
+};
+
+TEST(StaticReflNameFormat, CamelStructSnakeCfg)
+{
+    ///test_int = 10
+    ///#test_inner_list:
+    ///  ###
+    ///  test_str = Hello
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("test_int", "10", {1, 1});
+    auto& nodeList = tree->asItem().addNodeList("test_inner_list", {2, 1});
+    auto& node = nodeList.asList().emplaceBack({3, 3});
+    node.asItem().addParam("test_str", "Hello", {4, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::SnakeCase};
+    auto cfg = cfgReader.read<CamelStructSnakeCfg>("", parser);
+    EXPECT_EQ(cfg.testInt, 10);
+    ASSERT_EQ(cfg.testInnerList.size(), 1);
+    EXPECT_EQ(cfg.testInnerList.at(0).testStr, "Hello");
+}
+
+struct CamelStructKebabCfg {
+    int testInt;
+    std::vector<int> testIntList;
+};
+
+TEST(StaticReflNameFormat, CamelStructKebabCfg)
+{
+    ///test-int = 10
+    ///test-int-list = [1, 2]
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("test-int", "10", {1, 1});
+    tree->asItem().addParamList("test-int-list", {"1", "2"}, {2, 1});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::KebabCase};
+    auto cfg = cfgReader.read<CamelStructKebabCfg>("", parser);
+    EXPECT_EQ(cfg.testInt, 10);
+    EXPECT_EQ(cfg.testIntList, (std::vector<int>{1, 2}));
+}
+
+} //namespace test_nameformat
\ No newline at end of file
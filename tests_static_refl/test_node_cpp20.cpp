@@ -416,6 +416,76 @@ TEST(StaticReflTestNode, MultiNodeSingleLevelWithoutOptionalNode)
     ASSERT_FALSE(cfg.b);
 }
 
+TEST(StaticReflTestNode, MultiNodeSingleLevelReadTwice)
+{
+    ///foo = 5
+    ///bar = test
+    ///[a]
+    ///  testInt = 10
+    ///
+    ///[b]
+    ///  testInt = 11
+    ///  testString = Hello
+    ///
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("foo", "5", {1, 1});
+    tree->asItem().addParam("bar", "test", {2, 1});
+    auto& aNode = tree->asItem().addNode("a", {3, 1});
+    aNode.asItem().addParam("testInt", "10", {4, 3});
+    auto& bNode = tree->asItem().addNode("b", {5, 1});
+    bNode.asItem().addParam("testInt", "11", {6, 3});
+    bNode.asItem().addParam("testString", "Hello", {7, 3});
+
+    ///foo = 6
+    ///bar = test2
+    ///[a]
+    ///  testInt = 20
+    ///
+    auto tree2 = figcone::makeTreeRoot();
+    tree2->asItem().addParam("foo", "6", {1, 1});
+    tree2->asItem().addParam("bar", "test2", {2, 1});
+    auto& aNode2 = tree2->asItem().addNode("a", {3, 1});
+    aNode2.asItem().addParam("testInt", "20", {4, 3});
+
+    ///bar = test3
+    ///[a]
+    ///  testInt = 30
+    ///
+    auto tree3 = figcone::makeTreeRoot();
+    tree3->asItem().addParam("bar", "test3", {1, 1});
+    auto& aNode3 = tree3->asItem().addNode("a", {2, 1});
+    aNode3.asItem().addParam("testInt", "30", {3, 3});
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto parser2 = TreeProvider{std::move(tree2)};
+    auto parser3 = TreeProvider{std::move(tree3)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::CamelCase};
+    auto cfg = cfgReader.read<MultiNodeSingleLevelCfg>("", parser);
+    auto cfg2 = cfgReader.read<MultiNodeSingleLevelCfg>("", parser2);
+
+    EXPECT_EQ(cfg.foo, 5);
+    EXPECT_EQ(cfg.bar, "test");
+    EXPECT_EQ(cfg.a.testInt, 10);
+    ASSERT_TRUE(cfg.b);
+    EXPECT_EQ(cfg.b->testInt, 11);
+    EXPECT_EQ(cfg.b->testString, "Hello");
+
+    EXPECT_EQ(cfg2.foo, 6);
+    EXPECT_EQ(cfg2.bar, "test2");
+    EXPECT_EQ(cfg2.a.testInt, 20);
+    ASSERT_FALSE(cfg2.b);
+
+    assert_exception<figcone::ConfigError>(
+            [&]
+            {
+                cfgReader.read<MultiNodeSingleLevelCfg>("", parser3);
+            },
+            [](const figcone::ConfigError& error)
+            {
+                EXPECT_EQ(std::string{error.what()}, "[line:1, column:1] Root node: Parameter 'foo' is missing.");
+            });
+}
+
 struct MultiLevelCfg {
     int foo;
     std::string bar;
@@ -631,4 +631,44 @@ TEST(StaticReflTestNodeList, IncompleteListElementError)
             });
 }
 
+TEST(StaticReflTestNodeList, ParallelBinding)
+{
+    ///testStr = Hello
+    ///[[testNodes]]
+    ///  testInt = 0
+    ///...
+    ///[[testNodes]]
+    ///  testInt = 99
+    ///[[optTestNodes2]]
+    ///  testInt = 0
+    ///...
+    ///[[optTestNodes2]]
+    ///  testInt = 99
+
+    auto tree = figcone::makeTreeRoot();
+    tree->asItem().addParam("testStr", "Hello", {1, 1});
+    auto& testNodes = tree->asItem().addNodeList("testNodes", {2, 1});
+    auto& optTestNodes2 = tree->asItem().addNodeList("optTestNodes2", {202, 1});
+    for (auto i = 0; i < 100; ++i) {
+        auto& node = testNodes.asList().emplaceBack({2 + i * 2, 1});
+        node.asItem().addParam("testInt", std::to_string(i), {3 + i * 2, 3});
+        auto& optNode = optTestNodes2.asList().emplaceBack({202 + i * 2, 1});
+        optNode.asItem().addParam("testInt", std::to_string(i), {203 + i * 2, 3});
+    }
+
+    auto parser = TreeProvider{std::move(tree)};
+    auto cfgReader = figcone::ConfigReader{figcone::NameFormat::Original, figcone::NodeListParallelism{4, 1}};
+    auto cfg = cfgReader.read<Cfg>("", parser);
+
+    ASSERT_EQ(cfg.testNodes.size(), 100);
+    ASSERT_TRUE(cfg.optTestNodes2);
+    ASSERT_EQ(cfg.optTestNodes2->size(), 100);
+    for (auto i = 0; i < 100; ++i) {
+        EXPECT_EQ(cfg.testNodes.at(i).testInt, i);
+        EXPECT_EQ(cfg.optTestNodes2->at(i).testInt, i);
+    }
+    EXPECT_TRUE(cfg.optTestNodes.empty());
+    EXPECT_EQ(cfg.testStr, "Hello");
+}
+
 } //namespace test_nodelist